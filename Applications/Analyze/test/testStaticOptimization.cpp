@@ -42,6 +42,8 @@ void testLapackErrorDLASD4();
 
 void testModelWithPassiveForces();
 
+void testFastOptions();
+
 int main()
 {
     Array<string> muscleModelNames;
@@ -77,6 +79,14 @@ int main()
         failures.push_back("testModelWithPassiveForces");
     }
     
+    try {
+        testFastOptions();
+    }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testFastOptions");
+    }
+
     try {
         testLapackErrorDLASD4();
     }
@@ -200,6 +210,39 @@ void testModelWithPassiveForces() {
 
 }
 
+// The analytic constraint matrix and warm starts must not change the
+// solution (beyond the convergence tolerance of the optimizer).
+void testFastOptions() {
+    AnalyzeTool analyze1("staticoptimization_spring_Setup.xml");
+    analyze1.setResultsDir("ResultsSO_spring_default");
+    analyze1.run();
+
+    AnalyzeTool analyze2("staticoptimization_spring_Setup.xml");
+    analyze2.setResultsDir("ResultsSO_spring_fast");
+    auto& so = dynamic_cast<StaticOptimization&>(
+            analyze2.getAnalysisSet().get("StaticOptimization"));
+    so.setUseAnalyticConstraintMatrix(true);
+    so.setUseWarmStart(true);
+    analyze2.run();
+
+    const std::string prefix = "/walk_subject01_ankle_spring_StaticOptimization_";
+    Storage activations1("ResultsSO_spring_default" + prefix + "activation.sto");
+    Storage activations2("ResultsSO_spring_fast" + prefix + "activation.sto");
+    ASSERT(activations1.getSize() == activations2.getSize());
+    CHECK_STORAGE_AGAINST_STANDARD(activations2, activations1,
+        std::vector<double>(28, 0.01),
+        __FILE__, __LINE__,
+        "Activations with fast options failed.");
+
+    Storage forces1("ResultsSO_spring_default" + prefix + "force.sto");
+    Storage forces2("ResultsSO_spring_fast" + prefix + "force.sto");
+    CHECK_STORAGE_AGAINST_STANDARD(forces2, forces1,
+        std::vector<double>(48, 1.0),
+        __FILE__, __LINE__,
+        "Forces with fast options failed.");
+    cout << "test FastOptions passed." << endl;
+}
+
 void testLapackErrorDLASD4() {
     // With OpenSim 3.2 64bit, the 64 bit lapack library (in Simbody 3.3.1) 
     // crashes with an error[1] if there are not enough actuators (or under 
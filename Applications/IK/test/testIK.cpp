@@ -51,6 +51,19 @@ int main()
             "testInverseKinematicsGait2354 failed");
         cout << "testInverseKinematicsGait2354 passed" << endl;
 
+        // Solving chunks of frames in parallel must reproduce the serial
+        // solution to within the accuracy of the solver.
+        InverseKinematicsTool ikParallel(
+            "subject01_Setup_InverseKinematics.xml");
+        ikParallel.setMaximumNumberOfThreads(4);
+        ikParallel.setOutputMotionFileName("subject01_walk1_ik_parallel.mot");
+        ikParallel.run();
+        Storage resultParallel(ikParallel.getOutputMotionFileName());
+        CHECK_STORAGE_AGAINST_STANDARD(resultParallel, result1,
+            std::vector<double>(24, 1e-2), __FILE__, __LINE__,
+            "testInverseKinematicsGait2354 in parallel failed");
+        cout << "testInverseKinematicsGait2354 in parallel passed" << endl;
+
         InverseKinematicsTool ik2("subject01_Setup_InverseKinematics_NoModel.xml");
         Model mdl("subject01_simbody.osim");
         mdl.initSystem();
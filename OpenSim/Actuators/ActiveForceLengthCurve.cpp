@@ -85,8 +85,11 @@ void ActiveForceLengthCurve::constructProperties()
 void ActiveForceLengthCurve::buildCurve()
 {
     SimTK::Function* f = createSimTKFunction();
+    const double tolerance = m_curve.getLookupTableTolerance();
     m_curve = *(static_cast<SmoothSegmentedFunction*>(f));
     delete f;
+    m_curve.setLookupTableTolerance(tolerance);
+
     setObjectIsUpToDateWithProperties();
 }
 
@@ -177,6 +180,24 @@ double ActiveForceLengthCurve::
     return m_curve.calcDerivative(derivComponents, x);
 }
 
+void ActiveForceLengthCurve::
+    calcValues(const double* normFiberLengths, double* values, int n,
+               int order) const
+{
+    SimTK_ASSERT(isObjectUpToDateWithProperties(),
+        "ActiveForceLengthCurve: Curve is not up-to-date with its properties");
+    m_curve.calcValues(normFiberLengths, values, n, order);
+}
+
+void ActiveForceLengthCurve::setLookupTableTolerance(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.setLookupTableTolerance(tolerance);
+}
+
+double ActiveForceLengthCurve::getLookupTableTolerance() const
+{   return m_curve.getLookupTableTolerance(); }
+
 SimTK::Vec2 ActiveForceLengthCurve::getCurveDomain() const
 {
     SimTK_ASSERT(isObjectUpToDateWithProperties(),
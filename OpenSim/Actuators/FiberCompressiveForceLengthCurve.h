@@ -233,7 +233,7 @@ public:
     \endverbatim
 
     */
-    double calcValue(double aNormLength) const;
+    double calcValue(double aNormLength) const override;
 
  
     /** Implement the generic OpenSim::Function interface **/
@@ -266,7 +266,7 @@ public:
     \endverbatim
 
     */
-    double calcDerivative(double aNormLength, int order) const;
+    double calcDerivative(double aNormLength, int order) const override;
 
     /// If possible, use the simpler overload above.
     double calcDerivative(const std::vector<int>& derivComponents,
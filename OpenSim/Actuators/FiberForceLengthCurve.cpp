@@ -91,9 +91,10 @@ void FiberForceLengthCurve::buildCurve(bool computeIntegral)
             computeIntegral,
             getName());
 
+    const double tolerance = m_curve.getLookupTableTolerance();
     m_curve = *f;
     delete f;
-
+    m_curve.setLookupTableTolerance(tolerance);
     setObjectIsUpToDateWithProperties();
 }
 
@@ -238,6 +239,24 @@ double FiberForceLengthCurve::
     return m_curve.calcDerivative(derivComponents, x);
 }
 
+void FiberForceLengthCurve::
+    calcValues(const double* normFiberLengths, double* values, int n,
+               int order) const
+{
+    SimTK_ASSERT(isObjectUpToDateWithProperties(),
+        "FiberForceLengthCurve: Curve is not up-to-date with its properties");
+    m_curve.calcValues(normFiberLengths, values, n, order);
+}
+
+void FiberForceLengthCurve::setLookupTableTolerance(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.setLookupTableTolerance(tolerance);
+}
+
+double FiberForceLengthCurve::getLookupTableTolerance() const
+{   return m_curve.getLookupTableTolerance(); }
+
 double FiberForceLengthCurve::calcIntegral(double normFiberLength) const
 {
     SimTK_ASSERT(isObjectUpToDateWithProperties(),
@@ -87,8 +87,11 @@ void ForceVelocityCurve::constructProperties()
 void ForceVelocityCurve::buildCurve()
 {
     SimTK::Function* f = createSimTKFunction();
+    const double tolerance = m_curve.getLookupTableTolerance();
     m_curve = *(static_cast<SmoothSegmentedFunction*>(f));
     delete f;
+    m_curve.setLookupTableTolerance(tolerance);
+
     setObjectIsUpToDateWithProperties();
 }
 
@@ -195,6 +198,24 @@ double ForceVelocityCurve::
     return m_curve.calcDerivative(derivComponents, x);
 }
 
+void ForceVelocityCurve::
+    calcValues(const double* normFiberVelocities, double* values, int n,
+               int order) const
+{
+    SimTK_ASSERT(isObjectUpToDateWithProperties(),
+        "ForceVelocityCurve: Curve is not up-to-date with its properties");
+    m_curve.calcValues(normFiberVelocities, values, n, order);
+}
+
+void ForceVelocityCurve::setLookupTableTolerance(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.setLookupTableTolerance(tolerance);
+}
+
+double ForceVelocityCurve::getLookupTableTolerance() const
+{   return m_curve.getLookupTableTolerance(); }
+
 SimTK::Vec2 ForceVelocityCurve::getCurveDomain() const
 {
     SimTK_ASSERT(isObjectUpToDateWithProperties(),
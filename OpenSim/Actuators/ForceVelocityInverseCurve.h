@@ -271,7 +271,7 @@ public:
 
     /** Evaluates the inverse force-velocity curve at a force-velocity
     multiplier value of 'aForceVelocityMultiplier'. */
-    double calcValue(double aForceVelocityMultiplier) const;
+    double calcValue(double aForceVelocityMultiplier) const override;
 
     /** Calculates the derivative of the inverse force-velocity curve with
     respect to the force-velocity multiplier.
@@ -283,7 +283,7 @@ public:
         The derivative of the inverse force-velocity curve with respect to the
         force-velocity multiplier.
     */
-    double calcDerivative(double aForceVelocityMultiplier, int order) const;
+    double calcDerivative(double aForceVelocityMultiplier, int order) const override;
     
     /// If possible, use the simpler overload above.
     double calcDerivative(const std::vector<int>& derivComponents,
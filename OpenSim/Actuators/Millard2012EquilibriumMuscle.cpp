@@ -439,26 +439,26 @@ computeFiberEquilibrium(SimTK::State& s, bool solveForVelocity) const
         switch(result.first) {
 
         case StatusFromEstimateMuscleFiberState::Success_Converged:
-            setActuation(s, result.second["tendon_force"]);
-            setFiberLength(s, result.second["fiber_length"]);
+            setActuation(s, result.second.tendonForce);
+            setFiberLength(s, result.second.fiberLength);
             break;
 
         case StatusFromEstimateMuscleFiberState::Warning_FiberAtLowerBound:
             printf("\n\nMillard2012EquilibriumMuscle static solution:"
                    " %s is at its minimum fiber length of %f\n",
-                   getName().c_str(), result.second["fiber_length"]);
-            setActuation(s, result.second["tendon_force"]);
-            setFiberLength(s, result.second["fiber_length"]);
+                   getName().c_str(), result.second.fiberLength);
+            setActuation(s, result.second.tendonForce);
+            setFiberLength(s, result.second.fiberLength);
             break;
 
         case StatusFromEstimateMuscleFiberState::Failure_MaxIterationsReached:
             // Report internal variables and throw exception.
             std::ostringstream ss;
-            ss << "\n  Solution error " << abs(result.second["solution_error"])
+            ss << "\n  Solution error " << abs(result.second.solutionError)
                << " exceeds tolerance of " << tol << "\n"
                << "  Newton iterations reached limit of " << maxIter << "\n"
                << "  Activation is " << activation << "\n"
-               << "  Fiber length is " << result.second["fiber_length"] << "\n";
+               << "  Fiber length is " << result.second.fiberLength << "\n";
             OPENSIM_THROW_FRMOBJ(MuscleCannotEquilibrate, ss.str());
             break;
         }
@@ -1475,7 +1475,7 @@ Millard2012EquilibriumMuscle::estimateMuscleFiberState(
         iter++;
     }
 
-    // Populate the result map.
+    // Populate the result.
     ValuesFromEstimateMuscleFiberState resultValues;
 
     if(abs(ferr) < aSolTolerance) {  // The solution converged.
@@ -1484,11 +1484,11 @@ Millard2012EquilibriumMuscle::estimateMuscleFiberState(
             lce = getMinimumFiberLength();
         }
 
-        resultValues["solution_error"] = ferr;
-        resultValues["iterations"]     = (double)iter;
-        resultValues["fiber_length"]   = lce;
-        resultValues["fiber_velocity"] = dlce;
-        resultValues["tendon_force"]   = fse*fiso;
+        resultValues.solutionError = ferr;
+        resultValues.iterations    = iter;
+        resultValues.fiberLength   = lce;
+        resultValues.fiberVelocity = dlce;
+        resultValues.tendonForce   = fse*fiso;
 
         return std::pair<StatusFromEstimateMuscleFiberState,
                          ValuesFromEstimateMuscleFiberState>
@@ -1506,11 +1506,11 @@ Millard2012EquilibriumMuscle::estimateMuscleFiberState(
         tlN    = tl/tsl;
         fse    = fseCurve.calcValue(tlN);
 
-        resultValues["solution_error"] = ferr;
-        resultValues["iterations"]     = (double)iter;
-        resultValues["fiber_length"]   = lce;
-        resultValues["fiber_velocity"] = 0;
-        resultValues["tendon_force"]   = fse*fiso;
+        resultValues.solutionError = ferr;
+        resultValues.iterations    = iter;
+        resultValues.fiberLength   = lce;
+        resultValues.fiberVelocity = 0;
+        resultValues.tendonForce   = fse*fiso;
 
         return std::pair<StatusFromEstimateMuscleFiberState,
                          ValuesFromEstimateMuscleFiberState>
@@ -1518,11 +1518,11 @@ Millard2012EquilibriumMuscle::estimateMuscleFiberState(
              resultValues);
     }
 
-    resultValues["solution_error"] = ferr;
-    resultValues["iterations"]     = (double)iter;
-    resultValues["fiber_length"]   = SimTK::NaN;
-    resultValues["fiber_velocity"] = SimTK::NaN;
-    resultValues["tendon_force"]   = SimTK::NaN;
+    resultValues.solutionError = ferr;
+    resultValues.iterations    = iter;
+    resultValues.fiberLength   = SimTK::NaN;
+    resultValues.fiberVelocity = SimTK::NaN;
+    resultValues.tendonForce   = SimTK::NaN;
 
     return std::pair<StatusFromEstimateMuscleFiberState,
                         ValuesFromEstimateMuscleFiberState>
@@ -741,10 +741,14 @@ private:
         Failure_MaxIterationsReached
     };
 
-    // Associative array of values returned by estimateMuscleFiberState():
-    // solution_error, iterations, fiber_length, fiber_velocity, and
-    // tendon_force.
-    typedef std::map<std::string, double> ValuesFromEstimateMuscleFiberState;
+    // Values returned by estimateMuscleFiberState().
+    struct ValuesFromEstimateMuscleFiberState {
+        double solutionError;
+        int    iterations;
+        double fiberLength;
+        double fiberVelocity;
+        double tendonForce;
+    };
 
     /* Solves fiber length and velocity to satisfy the equilibrium equations.
     The velocity of the entire musculotendon actuator is shared between the
@@ -99,8 +99,11 @@ void TendonForceLengthCurve::buildCurve(bool computeIntegral)
                                      m_curvinessInUse,
                                      computeIntegral,
                                      getName());
+    const double tolerance = m_curve.getLookupTableTolerance();
     m_curve = *f;
     delete f;
+    m_curve.setLookupTableTolerance(tolerance);
+
     setObjectIsUpToDateWithProperties();
 }
 
@@ -242,6 +245,24 @@ double TendonForceLengthCurve::
     return m_curve.calcDerivative(derivComponents, x);
 }
 
+void TendonForceLengthCurve::
+    calcValues(const double* normTendonLengths, double* values, int n,
+               int order) const
+{
+    SimTK_ASSERT(isObjectUpToDateWithProperties(),
+        "TendonForceLengthCurve: Curve is not up-to-date with its properties");
+    m_curve.calcValues(normTendonLengths, values, n, order);
+}
+
+void TendonForceLengthCurve::setLookupTableTolerance(double tolerance)
+{
+    ensureCurveUpToDate();
+    m_curve.setLookupTableTolerance(tolerance);
+}
+
+double TendonForceLengthCurve::getLookupTableTolerance() const
+{   return m_curve.getLookupTableTolerance(); }
+
 double TendonForceLengthCurve::calcIntegral(double aNormLength) const
 {
     SimTK_ASSERT(isObjectUpToDateWithProperties(),
@@ -261,7 +261,7 @@ public:
 
     /** Evaluates the tendon-force-length curve at a normalized tendon length of
     'aNormLength'. */
-    double calcValue(double aNormLength) const;
+    double calcValue(double aNormLength) const override;
 
     /** Calculates the derivative of the tendon-force-length multiplier with
     respect to the normalized tendon length.
@@ -273,12 +273,29 @@ public:
         The derivative of the tendon-force-length curve with respect to the
         normalized tendon length.
     */
-    double calcDerivative(double aNormLength, int order) const;
+    double calcDerivative(double aNormLength, int order) const override;
     
     /// If possible, use the simpler overload above.
     double calcDerivative(const std::vector<int>& derivComponents,
                           const SimTK::Vector& x) const override;
 
+    /** Evaluates the curve, or one of its derivatives, at the n normalized
+    tendon lengths in normTendonLengths and writes the results to values. This
+    is cheaper than n calls to calcDerivative() when a lookup table tolerance
+    has been set (see setLookupTableTolerance()).
+    @see SmoothSegmentedFunction::calcValues() */
+    void calcValues(const double* normTendonLengths, double* values, int n,
+                    int order = 0) const override;
+
+    /** Tabulates the curve so that it is evaluated by interpolating a table
+    that matches it to the given tolerance, rather than exactly (see
+    SmoothSegmentedFunction::buildLookupTable()). The table is rebuilt
+    whenever the curve is. A tolerance of 0, the default, evaluates the curve
+    exactly. This setting is not a property and is not serialized. */
+    void setLookupTableTolerance(double tolerance);
+    /** @returns The tolerance of the lookup table, or 0 if there is none. */
+    double getLookupTableTolerance() const;
+
     /** Calculates the normalized area under the curve. Since it is expensive to
     construct, the curve is built only when necessary.
     @param aNormLength
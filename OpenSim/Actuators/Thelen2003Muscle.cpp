@@ -353,26 +353,26 @@ void Thelen2003Muscle::computeInitialFiberEquilibrium(SimTK::State& s) const
     switch(result.first) {
 
     case StatusFromInitMuscleState::Success_Converged:
-        setActuation(s, result.second["tendon_force"]);
-        setFiberLength(s, result.second["fiber_length"]);
+        setActuation(s, result.second.tendonForce);
+        setFiberLength(s, result.second.fiberLength);
         break;
 
     case StatusFromInitMuscleState::Warning_FiberAtLowerBound:
         printf("\n\nThelen2003Muscle initialization:"
                " %s is at its minimum fiber length of %f\n",
-               getName().c_str(), result.second["fiber_length"]);
-        setActuation(s, result.second["tendon_force"]);
-        setFiberLength(s, result.second["fiber_length"]);
+               getName().c_str(), result.second.fiberLength);
+        setActuation(s, result.second.tendonForce);
+        setFiberLength(s, result.second.fiberLength);
         break;
 
     case StatusFromInitMuscleState::Failure_MaxIterationsReached:
         // Report internal variables and throw exception.
         std::ostringstream ss;
-        ss << "\n  Solution error " << abs(result.second["solution_error"])
+        ss << "\n  Solution error " << abs(result.second.solutionError)
            << " exceeds tolerance of " << tol << "\n"
            << "  Newton iterations reached limit of " << maxIter << "\n"
            << "  Activation is " << activation << "\n"
-           << "  Fiber length is " << result.second["fiber_length"] << "\n";
+           << "  Fiber length is " << result.second.fiberLength << "\n";
         OPENSIM_THROW_FRMOBJ(MuscleCannotEquilibrate, ss.str());
         break;
     }
@@ -941,16 +941,16 @@ Thelen2003Muscle::initMuscleState(const SimTK::State& s,
         iter++;
     }
 
-    // Populate the result map.
+    // Populate the result.
     ValuesFromInitMuscleState resultValues;
 
     if (abs(ferr) < aSolTolerance) {  // The solution converged.
 
-        resultValues["solution_error"] = ferr;
-        resultValues["iterations"]     = (double)iter;
-        resultValues["fiber_length"]   = lce;
-        resultValues["passive_force"]  = fpe*fiso;
-        resultValues["tendon_force"]   = fse*fiso;
+        resultValues.solutionError = ferr;
+        resultValues.iterations    = iter;
+        resultValues.fiberLength   = lce;
+        resultValues.passiveForce  = fpe*fiso;
+        resultValues.tendonForce   = fse*fiso;
 
         return std::pair<StatusFromInitMuscleState, ValuesFromInitMuscleState>
             (StatusFromInitMuscleState::Success_Converged, resultValues);
@@ -968,21 +968,21 @@ Thelen2003Muscle::initMuscleState(const SimTK::State& s,
         fse = calcfse(tlN);
         fpe = calcfpe(lceN);
 
-        resultValues["solution_error"] = ferr;
-        resultValues["iterations"]     = (double)iter;
-        resultValues["fiber_length"]   = lce;
-        resultValues["passive_force"]  = fpe*fiso;
-        resultValues["tendon_force"]   = fse*fiso;
+        resultValues.solutionError = ferr;
+        resultValues.iterations    = iter;
+        resultValues.fiberLength   = lce;
+        resultValues.passiveForce  = fpe*fiso;
+        resultValues.tendonForce   = fse*fiso;
 
         return std::pair<StatusFromInitMuscleState, ValuesFromInitMuscleState>
            (StatusFromInitMuscleState::Warning_FiberAtLowerBound, resultValues);
     }
 
-    resultValues["solution_error"] = ferr;
-    resultValues["iterations"]     = (double)iter;
-    resultValues["fiber_length"]   = SimTK::NaN;
-    resultValues["passive_force"]  = SimTK::NaN;
-    resultValues["tendon_force"]   = SimTK::NaN;
+    resultValues.solutionError = ferr;
+    resultValues.iterations    = iter;
+    resultValues.fiberLength   = SimTK::NaN;
+    resultValues.passiveForce  = SimTK::NaN;
+    resultValues.tendonForce   = SimTK::NaN;
 
     return std::pair<StatusFromInitMuscleState, ValuesFromInitMuscleState>
         (StatusFromInitMuscleState::Failure_MaxIterationsReached, resultValues);
@@ -308,10 +308,14 @@ private:
         Failure_MaxIterationsReached
     };
 
-    // Associative array of values returned by initMuscleState():
-    // solution_error, iterations, fiber_length, passive_force, and
-    // tendon_force.
-    typedef std::map<std::string, double> ValuesFromInitMuscleState;
+    // Values returned by initMuscleState().
+    struct ValuesFromInitMuscleState {
+        double solutionError;
+        int    iterations;
+        double fiberLength;
+        double passiveForce;
+        double tendonForce;
+    };
 
     /* Calculate the muscle state such that the fiber and tendon are developing
     the same force.
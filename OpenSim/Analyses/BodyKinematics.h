@@ -122,6 +122,8 @@ public:
         step(const SimTK::State& s, int setNumber ) override;
     int
         end(const SimTK::State& s ) override;
+    /** Body kinematics at a frame depend only on the state at that frame. */
+    bool isFrameIndependent() const override { return true; }
 protected:
     virtual int
         record(const SimTK::State& s );
@@ -519,9 +519,10 @@ int InducedAccelerations::record(const SimTK::State& s)
     _comIndAccs.setSize(0);
     _constraintReactions.setSize(0);
 
-    SimTK::State s_analysis = _model->getWorkingState();
+    // The analysis state persists across frames; contributors are switched
+    // on and off through its instance-stage flags.
+    SimTK::State& s_analysis = _analysisState;
 
-    _model->initStateWithoutRecreatingSystem(s_analysis);
     // Just need to set current time and position to determine state of constraints
     s_analysis.setTime(aT);
     s_analysis.setQ(Q);
@@ -530,12 +531,18 @@ int InducedAccelerations::record(const SimTK::State& s)
     // and turn constraint on if it should be.
     Array<bool> constraintOn = applyContactConstraintAccordingToExternalForces(s_analysis);
 
-    // Hang on to a state that has the right flags for contact constraints turned on/off
-    _model->setPropertiesFromState(s_analysis);
-    // Use this state for the remainder of this step (record)
-    s_analysis = _model->getMultibodySystem().realizeTopology();
-    // DO NOT recreate the system, will lose location of constraint
-    _model->initStateWithoutRecreatingSystem(s_analysis);
+    // Placing a contact constraint at the current point of contact changes
+    // its default (topology) parameters, so only then does the analysis state
+    // have to be rebuilt from the updated system.
+    if(constraintOn.findIndex(true) >= 0){
+        s_analysis = _model->getMultibodySystem().realizeTopology();
+        // DO NOT recreate the system, will lose location of constraint
+        _model->initStateWithoutRecreatingSystem(s_analysis);
+        s_analysis.setTime(aT);
+        s_analysis.setQ(Q);
+        for(int i=0; i<constraintOn.getSize(); i++)
+            _constraintSet.get(i).setIsEnforced(s_analysis, constraintOn[i]);
+    }
 
     // Cycle through the force contributors to the system acceleration
     for(int c=0; c< _contributors.getSize(); c++){          
@@ -559,6 +566,16 @@ int InducedAccelerations::record(const SimTK::State& s)
                 _model->updActuators().get(f).setAppliesForce(s_analysis, true);
             }
 
+            // Undo any override left by a previous frame's potentials
+            if(_computePotentialsOnly){
+                for(int f=0; f<_model->getActuators().getSize(); f++){
+                    const ScalarActuator* act = dynamic_cast<const ScalarActuator*>(
+                        &_model->getActuators().get(f));
+                    if(act && act->isActuationOverridden(s_analysis))
+                        act->overrideActuation(s_analysis, false);
+                }
+            }
+
             // Get to  the point where we can evaluate unilateral constraint conditions
              _model->getMultibodySystem().realize(s_analysis, SimTK::Stage::Acceleration);
 
@@ -615,10 +632,6 @@ int InducedAccelerations::record(const SimTK::State& s)
                 // Make sure we stay at Dynamics so each constraint can evaluate its conditions
                 _model->getMultibodySystem().realize(s_analysis, SimTK::Stage::Acceleration);
             }
-
-            // This should also push changes to defaults for unilateral conditions
-            _model->setPropertiesFromState(s_analysis);
-
         }
         else if(_contributors[c] == "gravity"){
             // Set gravity ON
@@ -829,7 +842,8 @@ void InducedAccelerations::initialize(const SimTK::State& s)
     // Get value for gravity
     _gravity = _model->getGravity();
 
-    /*SimTK::State &s_analysis =*/_model->initSystem();
+    // Keep the initialized state to analyze every frame with
+    _analysisState = _model->initSystem();
 
     // UPDATE VARIABLES IN THIS CLASS
     constructDescription();
@@ -123,6 +123,10 @@ protected:
     // Hold the actual model gravity since we will be changing it back and forth from 0
     SimTK::Vec3 _gravity;
 
+    // State of the analysis copy of the model in which the contributors are
+    // toggled. It is reused from frame to frame.
+    SimTK::State _analysisState;
+
 
 //=============================================================================
 // METHODS
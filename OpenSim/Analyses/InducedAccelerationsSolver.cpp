@@ -84,12 +84,30 @@ const SimTK::Vector& InducedAccelerationsSolver::solve(const SimTK::State& s,
     // and turn constraint on if it should be.
     Array<bool> constraintOn = applyContactConstraintAccordingToExternalForces(s_solver);
 
-    // Hang on to a state that has the right flags for contact constraints turned on/off
-    _modelCopy.setPropertiesFromState(s_solver);
-    // Use this state for the remainder of this step (record)
-    s_solver = _modelCopy.getMultibodySystem().realizeTopology();
-    // DO NOT recreate the system, will lose location of constraint
-    _modelCopy.initStateWithoutRecreatingSystem(s_solver);
+    // Placing a contact constraint at the current point of contact changes
+    // its default (topology) parameters. Only then is the solver state
+    // rebuilt; otherwise contributors are toggled in the same state.
+    if(constraintOn.findIndex(true) >= 0){
+        s_solver = _modelCopy.getMultibodySystem().realizeTopology();
+        // DO NOT recreate the system, will lose location of constraint
+        _modelCopy.initStateWithoutRecreatingSystem(s_solver);
+        s_solver.updQ() = s.getQ();
+        s_solver.updU() = s.getU();
+        for(int i=0; i<constraintOn.getSize(); i++)
+            _replacementConstraints[i].setIsEnforced(s_solver, constraintOn[i]);
+    }
+
+    // The state is reused from the previous solve, so first restore the
+    // forces the model applies before toggling those of this contributor.
+    for(int f=0; f<_modelCopy.getForceSet().getSize(); f++){
+        const Force& force = _modelCopy.getForceSet()[f];
+        force.setAppliesForce(s_solver, force.get_appliesForce());
+        const ScalarActuator* actuator =
+            dynamic_cast<const ScalarActuator*>(&force);
+        if(actuator && actuator->isActuationOverridden(s_solver))
+            actuator->overrideActuation(s_solver, false);
+    }
+    _modelCopy.getGravityForce().enable(s_solver);
 
     //cout << "Solving for contributor: " << _contributors[c] << endl;
     // Need to be at the dynamics stage to disable a force
@@ -102,7 +120,7 @@ const SimTK::Vector& InducedAccelerationsSolver::solve(const SimTK::State& s,
 
         //Use same conditions on constraints
         s_solver.updU() = s.getU();
-        s_solver.updU() = s.getZ();
+        s_solver.updZ() = s.getZ();
 
         //Make sure all the actuators are on!
         for(int f=0; f<_modelCopy.getActuators().getSize(); f++){
@@ -164,10 +182,6 @@ const SimTK::Vector& InducedAccelerationsSolver::solve(const SimTK::State& s,
             // Make sure we stay at Dynamics so each constraint can evaluate its conditions
             _modelCopy.getMultibodySystem().realize(s_solver, SimTK::Stage::Acceleration);
         }
-
-        // This should also push changes to defaults for unilateral conditions
-        _modelCopy.setPropertiesFromState(s_solver);
-
     }
     else if(forceName == "gravity"){
         // Set gravity ON
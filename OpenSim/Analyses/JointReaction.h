@@ -190,6 +190,9 @@ public:
         step( const SimTK::State& s, int setNumber ) override;
     int
         end( const SimTK::State& s ) override;
+    /** Reaction loads at a frame depend only on the state (and the actuator
+    forces, if given) at that frame. */
+    bool isFrameIndependent() const override { return true; }
 
 
     //-------------------------------------------------------------------------
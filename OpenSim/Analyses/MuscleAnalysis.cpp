@@ -205,6 +205,7 @@ void MuscleAnalysis::allocateStorageObjects()
     _momentArmStorageArray.setSize(0);
     _muscleArray.setMemoryOwner(false);
     _muscleArray.setSize(0);
+    _maSolver.reset();
 
     // FOR MOMENT ARMS AND MOMENTS
     if(_computeMoments) {
@@ -642,23 +643,33 @@ int MuscleAnalysis::record(const SimTK::State& s)
 
     if (_computeMoments){
         // LOOP OVER ACTIVE MOMENT ARM STORAGE OBJECTS
-        Coordinate *q = NULL;
         Storage *maStore=NULL, *mStore=NULL;
         int nq = _momentArmStorageArray.getSize();
         Array<double> ma(0.0,nm),m(0.0,nm);
 
+        SimTK::Array_<const Coordinate*> coords(nq);
         for(int i=0; i<nq; i++) {
+            coords[i] = _momentArmStorageArray[i]->q;
+        }
+        SimTK::Array_<const GeometryPath*> paths(nm);
+        for(int j=0; j<nm; j++) {
+            paths[j] = &_muscleArray[j]->getGeometryPath();
+        }
 
-            q = _momentArmStorageArray[i]->q;
+        _model->getMultibodySystem().realize(s, s.getSystemStage());
+
+        // SOLVE FOR ALL MUSCLES ABOUT ALL COORDINATES AT ONCE
+        if(!_maSolver)
+            _maSolver.reset(new MomentArmSolver(*_model));
+        SimTK::Matrix maMatrix = _maSolver->solve(s, coords, paths);
+
+        for(int i=0; i<nq; i++) {
             maStore = _momentArmStorageArray[i]->momentArmStore;
             mStore = _momentArmStorageArray[i]->momentStore;
-           
-            // bool locked = q->getLocked(s);
 
-            _model->getMultibodySystem().realize(s, s.getSystemStage());
             // LOOP OVER MUSCLES
             for(int j=0; j<nm; j++) {
-                ma[j] = _muscleArray[j]->computeMomentArm(s,*q);
+                ma[j] = maMatrix(j, i);
                 m[j] = ma[j] * force[j];
             }
             maStore->append(s.getTime(),nm,&ma[0]);
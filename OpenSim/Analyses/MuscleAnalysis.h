@@ -140,6 +140,12 @@ private:
 #endif
     /** Array of active muscles. */
     ArrayPtrs<Muscle> _muscleArray;
+#ifndef SWIG
+    /** Solver used to compute the moment arms of all active muscles about
+    all active coordinates in a single pass. Created on first use and cleared
+    on copy or whenever the storage objects are (re)allocated. */
+    SimTK::ResetOnCopy<std::unique_ptr<MomentArmSolver> > _maSolver;
+#endif
 
 //=============================================================================
 // METHODS
@@ -230,6 +236,9 @@ public:
         step(const SimTK::State& s, int setNumber ) override;
     int
         end( const SimTK::State& s ) override;
+    /** Muscle quantities and moment arms at a frame depend only on the state
+    at that frame. */
+    bool isFrameIndependent() const override { return true; }
 protected:
     virtual int
         record(const SimTK::State& s );
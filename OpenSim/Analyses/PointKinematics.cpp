@@ -274,6 +274,12 @@ allocateStorage()
     _pStore = new Storage(1000,"PointPosition");
     _pStore->setDescription(getDescription());
     _pStore->setColumnLabels(getColumnLabels());
+
+    _storageList.setMemoryOwner(false);
+    _storageList.setSize(0);
+    _storageList.append(_aStore);
+    _storageList.append(_vStore);
+    _storageList.append(_pStore);
 }
 
 
@@ -290,6 +296,7 @@ deleteStorage()
     if(_aStore!=NULL) { delete _aStore;  _aStore=NULL; }
     if(_vStore!=NULL) { delete _vStore;  _vStore=NULL; }
     if(_pStore!=NULL) { delete _pStore;  _pStore=NULL; }
+    _storageList.setSize(0);
 }
 
 
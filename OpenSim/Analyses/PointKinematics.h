@@ -147,6 +147,8 @@ public:
     int begin(const SimTK::State& s) override;
     int step(const SimTK::State& s, int setNumber) override;
     int end(const SimTK::State& s) override;
+    /** Point kinematics at a frame depend only on the state at that frame. */
+    bool isFrameIndependent() const override { return true; }
 protected:
     virtual int
         record(const SimTK::State& s );
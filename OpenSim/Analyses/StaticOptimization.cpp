@@ -61,6 +61,8 @@ StaticOptimization::StaticOptimization(Model *aModel) :
     _useMusclePhysiology(_useMusclePhysiologyProp.getValueBool()),
     _convergenceCriterion(_convergenceCriterionProp.getValueDbl()),
     _maximumIterations(_maximumIterationsProp.getValueInt()),
+    _useAnalyticConstraintMatrix(_useAnalyticConstraintMatrixProp.getValueBool()),
+    _useWarmStart(_useWarmStartProp.getValueBool()),
     _modelWorkingCopy(NULL)
 {
     setNull();
@@ -82,6 +84,8 @@ StaticOptimization::StaticOptimization(const StaticOptimization &aStaticOptimiza
     _useMusclePhysiology(_useMusclePhysiologyProp.getValueBool()),
     _convergenceCriterion(_convergenceCriterionProp.getValueDbl()),
     _maximumIterations(_maximumIterationsProp.getValueInt()),
+    _useAnalyticConstraintMatrix(_useAnalyticConstraintMatrixProp.getValueBool()),
+    _useWarmStart(_useWarmStartProp.getValueBool()),
     _modelWorkingCopy(NULL)
 {
     setNull();
@@ -114,6 +118,8 @@ operator=(const StaticOptimization &aStaticOptimization)
     _activationExponent=aStaticOptimization._activationExponent;
     _convergenceCriterion=aStaticOptimization._convergenceCriterion;
     _maximumIterations=aStaticOptimization._maximumIterations;
+    _useAnalyticConstraintMatrix=aStaticOptimization._useAnalyticConstraintMatrix;
+    _useWarmStart=aStaticOptimization._useWarmStart;
     _forceReporter = nullptr;
     _useMusclePhysiology=aStaticOptimization._useMusclePhysiology;
     return(*this);
@@ -138,6 +144,8 @@ void StaticOptimization::setNull()
     _numCoordinateActuators = 0;
     _convergenceCriterion = 1e-4;
     _maximumIterations = 100;
+    _useAnalyticConstraintMatrix = false;
+    _useWarmStart = false;
     _forceReporter = nullptr;
     setName("StaticOptimization");
 }
@@ -173,6 +181,17 @@ setupProperties()
         "An integer for setting the maximum number of iterations the optimizer can use at each time.  ");
     _maximumIterationsProp.setName("optimizer_max_iterations");
     _propertySet.append(&_maximumIterationsProp);
+
+    _useAnalyticConstraintMatrixProp.setComment(
+        "If true, the dependence of the accelerations on the activations is computed from the mass matrix "
+        "and the forces of the actuators rather than by realizing the accelerations once per actuator.");
+    _useAnalyticConstraintMatrixProp.setName("use_analytic_constraint_matrix");
+    _propertySet.append(&_useAnalyticConstraintMatrixProp);
+
+    _useWarmStartProp.setComment(
+        "If true, the optimization at each time starts from the solution at the previous time instead of from zero.");
+    _useWarmStartProp.setName("use_warm_start");
+    _propertySet.append(&_useWarmStartProp);
 }
 
 //=============================================================================
@@ -337,13 +356,15 @@ record(const SimTK::State& s)
     target.setStatesSplineSet(_statesSplineSet);
     target.setActivationExponent(_activationExponent);
     target.setDX(_numericalDerivativeStepSize);
+    target.setUseAnalyticConstraintMatrix(_useAnalyticConstraintMatrix);
 
     // Pick optimizer algorithm
     SimTK::OptimizerAlgorithm algorithm = SimTK::InteriorPoint;
     //SimTK::OptimizerAlgorithm algorithm = SimTK::CFSQP;
 
     // Optimizer
-    SimTK::Optimizer *optimizer = new SimTK::Optimizer(target, algorithm);
+    std::unique_ptr<SimTK::Optimizer> optimizer(
+            new SimTK::Optimizer(target, algorithm));
 
     // Optimizer options
     //cout<<"\nSetting optimizer print level to "<<_printLevel<<".\n";
@@ -375,7 +396,7 @@ record(const SimTK::State& s)
     
     target.setParameterLimits(lowerBounds, upperBounds);
 
-    _parameters = 0; // Set initial guess to zeros
+    if(!_useWarmStart) _parameters = 0; // Set initial guess to zeros
 
     // Static optimization
     _modelWorkingCopy->getMultibodySystem().realize(sWorkingCopy,SimTK::Stage::Velocity);
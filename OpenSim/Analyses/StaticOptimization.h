@@ -76,6 +76,12 @@ protected:
     PropertyInt _maximumIterationsProp;
     int &_maximumIterations;
 
+    PropertyBool _useAnalyticConstraintMatrixProp;
+    bool &_useAnalyticConstraintMatrix;
+
+    PropertyBool _useWarmStartProp;
+    bool &_useWarmStart;
+
     Storage *_activationStorage;
     Storage *_forceStorage;
     GCVSplineSet _statesSplineSet;
@@ -135,6 +141,15 @@ public:
     double getConvergenceCriterion() { return _convergenceCriterion; }
     void setMaxIterations( const int maxIt) { _maximumIterations = maxIt; }
     int getMaxIterations() {return _maximumIterations; }
+    /** Compute how the accelerations depend on the activations from the
+    mass matrix and the forces that each actuator applies, instead of by
+    realizing the accelerations of the model once for each actuator. */
+    void setUseAnalyticConstraintMatrix(const bool useIt) { _useAnalyticConstraintMatrix = useIt; }
+    bool getUseAnalyticConstraintMatrix() const { return _useAnalyticConstraintMatrix; }
+    /** Start the optimization at each time from the solution at the previous
+    time rather than from zero activations. */
+    void setUseWarmStart(const bool useIt) { _useWarmStart = useIt; }
+    bool getUseWarmStart() const { return _useWarmStart; }
     //--------------------------------------------------------------------------
     // ANALYSIS
     //--------------------------------------------------------------------------
@@ -30,7 +30,10 @@
 // INCLUDES
 //=============================================================================
 #include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/Model/PathActuator.h>
+#include <OpenSim/Actuators/CoordinateActuator.h>
 #include "StaticOptimizationTarget.h"
+#include <simmath/LinearAlgebra.h>
 
 using namespace OpenSim;
 using namespace std;
@@ -65,6 +68,7 @@ StaticOptimizationTarget(const SimTK::State& s, Model *aModel,int aNP,int aNC, b
     _recipOptForceSquared.setSize(aNP);
     _optimalForce.setSize(aNP);
     _useMusclePhysiology=useMusclePhysiology;
+    _useAnalyticConstraintMatrix = false;
 
     setModel(*aModel);
     setNumParams(aNP);
@@ -127,11 +131,18 @@ prepareToOptimize(SimTK::State& s, double *x)
     pVector = 0;
     computeConstraintVector(s, pVector,_constraintVector);
 
-    for(int p=0; p<np; p++) {
-        pVector[p] = 1;
-        computeConstraintVector(s, pVector, cVector);
-        for(int c=0; c<nc; c++) _constraintMatrix(c,p) = (cVector[c] - _constraintVector[c]);
-        pVector[p] = 0;
+    // multiplyByMInv() treats every mobility as free, so mobilities whose
+    // motion is prescribed (other than by Constraints) need perturbation.
+    if(_useAnalyticConstraintMatrix &&
+       _model->getMatterSubsystem().getPrescribedUDotIndex(s).empty()) {
+        computeAnalyticConstraintMatrix(s);
+    } else {
+        for(int p=0; p<np; p++) {
+            pVector[p] = 1;
+            computeConstraintVector(s, pVector, cVector);
+            for(int c=0; c<nc; c++) _constraintMatrix(c,p) = (cVector[c] - _constraintVector[c]);
+            pVector[p] = 0;
+        }
     }
 #endif
 
@@ -683,3 +694,87 @@ computeAcceleration(SimTK::State& s, const SimTK::Vector &parameters,SimTK::Vect
 
     // 1.45 ms
 }
+//______________________________________________________________________________
+/**
+ * Compute the linear constraint matrix from one factorization of the mass
+ * matrix. The acceleration constraints are affine in the parameters, so
+ * column p of the matrix is the change in the (negated) accelerations caused
+ * by the generalized forces of actuator p at its optimal force. With
+ * constraint matrix G, these accelerations are
+ *     udot = M^-1 (f - G^T lambda), where (G M^-1 G^T) lambda = G M^-1 f.
+ * The constant constraint vector must have been computed already, which
+ * leaves the state realized through Acceleration.
+ */
+void StaticOptimizationTarget::
+computeAnalyticConstraintMatrix(SimTK::State& s)
+{
+    const SimTK::SimbodyMatterSubsystem& matter = _model->getMatterSubsystem();
+    const int np = getNumParameters();
+    const int nc = getNumConstraints();
+    const int nu = s.getNU();
+
+    // Projection onto the accelerations that satisfy the constraints.
+    Matrix G;
+    matter.calcG(s, G);
+    const int m = G.nrow();
+    Matrix MInvGt(nu, m);
+    SimTK::FactorQTZ GMInvGt;
+    if(m > 0) {
+        const Matrix Gt = ~G;
+        Vector col(nu);
+        for(int k=0; k<m; k++) {
+            matter.multiplyByMInv(s, Vector(Gt(k)), col);
+            MInvGt(k) = col;
+        }
+        // Redundant constraints make G M^-1 G^T singular; FactorQTZ gives
+        // the least-squares multipliers, as Simbody does.
+        GMInvGt.factor(Matrix(G*MInvGt));
+    }
+
+    SimTK::Vector_<SimTK::SpatialVec> bodyForces(matter.getNumBodies());
+    Vector mobilityForces(nu), generalizedForces(nu), udot(nu), lambda(m);
+    Vector pVector(np, 0.0), cVector(nc);
+
+    const ForceSet& fSet = _model->getForceSet();
+    for(int i=0, p=0; i<fSet.getSize(); i++) {
+        const ScalarActuator* act =
+            dynamic_cast<const ScalarActuator*>(&fSet.get(i));
+        if(!act) continue;
+
+        const PathActuator* pathAct = dynamic_cast<const PathActuator*>(act);
+        const CoordinateActuator* coordAct =
+            dynamic_cast<const CoordinateActuator*>(act);
+        if(!act->appliesForce(s)) {
+            for(int c=0; c<nc; c++) _constraintMatrix(c,p) = 0;
+        } else if(pathAct || (coordAct && coordAct->isCoordinateValid())) {
+            bodyForces.setToZero();
+            mobilityForces.setToZero();
+            if(pathAct) {
+                pathAct->getGeometryPath().addInEquivalentForces(s,
+                    _optimalForce[p], bodyForces, mobilityForces);
+            } else {
+                const Coordinate& coord = *coordAct->getCoordinate();
+                matter.getMobilizedBody(coord.getBodyIndex())
+                    .applyOneMobilityForce(s, coord.getMobilizerQIndex(),
+                        _optimalForce[p], mobilityForces);
+            }
+            matter.multiplyBySystemJacobianTranspose(s, bodyForces,
+                                                     generalizedForces);
+            generalizedForces += mobilityForces;
+            matter.multiplyByMInv(s, generalizedForces, udot);
+            if(m > 0) {
+                GMInvGt.solve(Vector(G*udot), lambda);
+                udot -= MInvGt*lambda;
+            }
+            for(int c=0; c<nc; c++)
+                _constraintMatrix(c,p) = -udot[_accelerationIndices[c]];
+        } else {
+            // Other actuators apply forces we cannot get at; perturb.
+            pVector[p] = 1;
+            computeConstraintVector(s, pVector, cVector);
+            for(int c=0; c<nc; c++) _constraintMatrix(c,p) = (cVector[c] - _constraintVector[c]);
+            pVector[p] = 0;
+        }
+        p++;
+    }
+}
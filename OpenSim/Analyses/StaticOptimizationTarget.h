@@ -71,6 +71,7 @@ private:
 protected:
     double _activationExponent;
     bool   _useMusclePhysiology;
+    bool   _useAnalyticConstraintMatrix;
     /** Perturbation size for computing numerical derivatives. */
     Array<double> _dx;
     Array<int> _accelerationIndices;
@@ -96,6 +97,17 @@ public:
     double getActivationExponent() const { return _activationExponent; }
     void setCurrentState( const SimTK::State* state) { _currentState = state; }
     const SimTK::State* getCurrentState() const { return _currentState; }
+    /** Compute the (linear) dependence of the acceleration constraints on
+    the parameters from the mass matrix and the forces that each actuator
+    applies, rather than by perturbing each parameter and realizing the
+    accelerations of the model. Columns for actuators that are neither
+    PathActuators nor CoordinateActuators are still computed by perturbation,
+    as is the whole matrix when the motion of some mobilizer is prescribed.
+    The default is false. */
+    void setUseAnalyticConstraintMatrix(bool useIt)
+    {   _useAnalyticConstraintMatrix = useIt; }
+    bool getUseAnalyticConstraintMatrix() const
+    {   return _useAnalyticConstraintMatrix; }
 
     // UTILITY
     void validatePerturbationSize(double &aSize);
@@ -124,6 +136,7 @@ public:
 private:
     void computeConstraintVector(SimTK::State& s, const SimTK::Vector &x, SimTK::Vector &c) const;
     void computeAcceleration(SimTK::State& s, const SimTK::Vector &aF,SimTK::Vector &rAccel) const;
+    void computeAnalyticConstraintMatrix(SimTK::State& s);
     void cumulativeTime(double &aTime, double aIncrement);
 };
 
@@ -0,0 +1,195 @@
+#ifndef OPENSIM_BENCHMARK_H_
+#define OPENSIM_BENCHMARK_H_
+/* -------------------------------------------------------------------------- *
+ *                          OpenSim:  Benchmark.h                             *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// A minimal harness for timing kernels and comparing the timings against
+// those of an earlier run. Results are written as CSV:
+//
+//     # <comment lines, e.g., the OpenSim version>
+//     name,iterations,samples,median_s,min_s
+//     GeometryPath::computePath/arm26,2048,9,1.2e-05,1.1e-05
+//
+// where the times are per iteration, in seconds.
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+namespace Benchmark {
+
+/** Keep the compiler from optimizing away a computation whose result is
+otherwise unused. */
+inline void keep(double value) {
+    static volatile double sink;
+    sink = value;
+}
+
+/** Timing of one benchmark. */
+struct Result {
+    std::string name;
+    int iterations; // per sample
+    int samples;
+    double median;  // seconds per iteration
+    double min;     // seconds per iteration
+};
+
+class Runner {
+public:
+    /** Each benchmark is timed numSamples times, and each sample calls the
+    kernel as many times as are needed to take at least minSampleTime
+    seconds. Only benchmarks whose name contains filter are run. */
+    Runner(int numSamples, double minSampleTime, const std::string& filter) :
+        _numSamples(numSamples), _minSampleTime(minSampleTime),
+        _filter(filter) {}
+
+    /** Time kernel(), which performs one iteration of the benchmark. The
+    calls that determine the number of iterations per sample also warm up
+    caches and allocations; they are not part of the result. */
+    template <typename Kernel>
+    void run(const std::string& name, Kernel kernel) {
+        if (!_filter.empty() && name.find(_filter) == std::string::npos)
+            return;
+
+        using Clock = std::chrono::steady_clock;
+        auto timeIterations = [&kernel](int n) {
+            const auto start = Clock::now();
+            for (int i = 0; i < n; ++i) kernel();
+            const std::chrono::duration<double> duration =
+                Clock::now() - start;
+            return duration.count();
+        };
+
+        int n = 1;
+        double time = timeIterations(n);
+        while (time < _minSampleTime && n < (1 << 24)) {
+            n *= 2;
+            time = timeIterations(n);
+        }
+
+        std::vector<double> times(_numSamples);
+        for (int k = 0; k < _numSamples; ++k)
+            times[k] = timeIterations(n) / n;
+        std::sort(times.begin(), times.end());
+        const int mid = _numSamples / 2;
+        const double median = _numSamples % 2 ? times[mid]
+                : 0.5*(times[mid - 1] + times[mid]);
+
+        const Result result{name, n, _numSamples, median, times.front()};
+        std::cout << std::left << std::setw(64) << name << std::right
+                  << std::setw(14) << median << " s  (min " << result.min
+                  << " s, " << n << " iterations x " << _numSamples
+                  << " samples)" << std::endl;
+        _results.push_back(result);
+    }
+
+    const std::vector<Result>& getResults() const { return _results; }
+
+    void writeCSV(const std::string& fileName,
+                  const std::vector<std::string>& comments) const {
+        std::ofstream out(fileName);
+        if (!out)
+            throw std::runtime_error("Could not open " + fileName + ".");
+        for (const auto& comment : comments)
+            out << "# " << comment << "\n";
+        out << "name,iterations,samples,median_s,min_s\n";
+        out << std::setprecision(6);
+        for (const auto& r : _results) {
+            out << r.name << "," << r.iterations << "," << r.samples << ","
+                << r.median << "," << r.min << "\n";
+        }
+    }
+
+private:
+    int _numSamples;
+    double _minSampleTime;
+    std::string _filter;
+    std::vector<Result> _results;
+};
+
+/** Read the median times (seconds per iteration) by benchmark name from a
+file written by Runner::writeCSV(). */
+inline std::map<std::string, double> readBaseline(const std::string& fileName)
+{
+    std::ifstream in(fileName);
+    if (!in)
+        throw std::runtime_error("Could not open baseline " + fileName + ".");
+    std::map<std::string, double> baseline;
+    std::string line;
+    bool isHeader = true;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        if (isHeader) { isHeader = false; continue; }
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, ',')) fields.push_back(field);
+        if (fields.size() < 4)
+            throw std::runtime_error("Malformed line in baseline " +
+                                     fileName + ": " + line);
+        baseline[fields[0]] = std::stod(fields[3]);
+    }
+    return baseline;
+}
+
+/** Print the ratio of each median time to that of the baseline, and return
+the number of benchmarks that are slower than the baseline by more than the
+given fraction (e.g., 0.1 for 10%). Benchmarks missing from the baseline are
+reported but never count as regressions. */
+inline int compareToBaseline(const std::vector<Result>& results,
+                             const std::map<std::string, double>& baseline,
+                             double tolerance, std::ostream& out)
+{
+    int numRegressions = 0;
+    out << "\nComparison with baseline (tolerance "
+        << 100*tolerance << "%):" << std::endl;
+    for (const auto& r : results) {
+        out << std::left << std::setw(64) << r.name << std::right;
+        const auto it = baseline.find(r.name);
+        if (it == baseline.end()) {
+            out << "  not in baseline" << std::endl;
+            continue;
+        }
+        const double ratio = r.median / it->second;
+        out << std::setw(10) << std::fixed << std::setprecision(3) << ratio
+            << "x" << std::defaultfloat << std::setprecision(6);
+        if (ratio > 1 + tolerance) {
+            out << "  REGRESSION";
+            ++numRegressions;
+        }
+        out << std::endl;
+    }
+    return numRegressions;
+}
+
+} // namespace Benchmark
+} // namespace OpenSim
+
+#endif // OPENSIM_BENCHMARK_H_
@@ -0,0 +1,293 @@
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  benchmarkCoreKernels.cpp                     *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// Microbenchmarks of the kernels that dominate the run time of the tools, on
+// the models bundled with the tests. Every benchmark visits the same inputs
+// in the same order on every run, so that timings of different builds can be
+// compared. Run with --help for the options.
+
+#include "Benchmark.h"
+
+#include <OpenSim/OpenSim.h>
+#include <OpenSim/Common/CSVFileAdapter.h>
+#include <OpenSim/Common/STOFileAdapter.h>
+#include <OpenSim/Common/SmoothSegmentedFunctionFactory.h>
+#include <OpenSim/Simulation/InverseKinematicsSolver.h>
+#include <OpenSim/Simulation/MarkersReference.h>
+#include <OpenSim/Simulation/MomentArmSolver.h>
+#include <OpenSim/version.h>
+
+#include <memory>
+
+using namespace OpenSim;
+using namespace SimTK;
+using namespace std;
+
+namespace {
+
+// Values of the coordinate over one period of a smooth sweep through its
+// range, so that consecutive values (including the last and the first) are
+// close, as they are in a motion.
+vector<double> sweepRange(const Coordinate& coordinate, int numValues)
+{
+    const double lower = coordinate.getRangeMin();
+    const double upper = coordinate.getRangeMax();
+    vector<double> values(numValues);
+    for (int i = 0; i < numValues; ++i) {
+        values[i] = lower +
+            (upper - lower)*0.5*(1 - std::cos(2*Pi*i/numValues));
+    }
+    return values;
+}
+
+void benchmarkArm26(Benchmark::Runner& runner)
+{
+    Model model("arm26.osim");
+    State& s = model.initSystem();
+    const Coordinate& elbow = model.getCoordinateSet().get("r_elbow_flex");
+    const auto& muscles = model.getMuscles();
+
+    // Changing the elbow angle invalidates the paths of all muscles.
+    const vector<double> angles = sweepRange(elbow, 64);
+    size_t frame = 0;
+    runner.run("GeometryPath::computePath/arm26", [&]() {
+        elbow.setValue(s, angles[frame++ % angles.size()], false);
+        model.realizePosition(s);
+        double length = 0;
+        for (int i = 0; i < muscles.getSize(); ++i)
+            length += muscles[i].getGeometryPath().getLength(s);
+        Benchmark::keep(length);
+    });
+
+    elbow.setValue(s, 0.5*(elbow.getRangeMin() + elbow.getRangeMax()));
+    model.realizeVelocity(s);
+    MomentArmSolver solver(model);
+    const GeometryPath& path = muscles.get("BIClong").getGeometryPath();
+    runner.run("MomentArmSolver::solve/arm26", [&]() {
+        Benchmark::keep(solver.solve(s, elbow, path));
+    });
+
+    // The initial guess of the fiber length comes from the length of the
+    // path, so that every iteration does the same work.
+    runner.run("Thelen2003Muscle::computeInitialFiberEquilibrium/arm26",
+        [&]() {
+            for (int i = 0; i < muscles.getSize(); ++i)
+                muscles[i].computeEquilibrium(s);
+        });
+
+    Model fresh("arm26.osim");
+    runner.run("Model::initSystem/arm26", [&]() {
+        Benchmark::keep(fresh.initSystem().getNY());
+    });
+}
+
+void benchmarkGait10dof18musc(Benchmark::Runner& runner)
+{
+    Model model("gait10dof18musc_subject01.osim");
+    State& s = model.initSystem();
+    const auto& muscles = model.getMuscles();
+
+    model.realizeVelocity(s);
+    runner.run(
+        "Millard2012EquilibriumMuscle::computeInitialFiberEquilibrium/"
+        "gait10dof18musc",
+        [&]() {
+            for (int i = 0; i < muscles.getSize(); ++i)
+                muscles[i].computeEquilibrium(s);
+        });
+
+    Model fresh("gait10dof18musc_subject01.osim");
+    runner.run("Model::initSystem/gait10dof18musc", [&]() {
+        Benchmark::keep(fresh.initSystem().getNY());
+    });
+
+    MarkersReference markersReference(
+            "gait10dof18musc_walk_CRLF_line_ending.trc");
+    SimTK::Array_<CoordinateReference> coordinateReferences;
+    InverseKinematicsSolver ik(model, markersReference, coordinateReferences);
+    ik.setAccuracy(1e-5);
+    const auto& times =
+        markersReference.getMarkerTable().getIndependentColumn();
+    s.updTime() = times.front();
+    ik.assemble(s);
+
+    // Track the frames forward, then backward, and so on, so that every
+    // call to track() starts from the pose of an adjacent frame.
+    const int numFrames = static_cast<int>(times.size());
+    int frame = 0;
+    int step = 1;
+    runner.run("InverseKinematicsSolver::track/gait10dof18musc", [&]() {
+        if (frame == 0) step = 1;
+        else if (frame == numFrames - 1) step = -1;
+        frame += step;
+        s.updTime() = times[frame];
+        ik.track(s);
+    });
+}
+
+void benchmarkCurves(Benchmark::Runner& runner)
+{
+    std::unique_ptr<SmoothSegmentedFunction> curve(
+        SmoothSegmentedFunctionFactory::createFiberActiveForceLengthCurve(
+            0.5, 0.75, 1, 1.5, 0.1, 0.75, 0.9, false, "benchmark"));
+
+    // Points spread over all of the segments of the curve, including the
+    // linear extrapolation on either side.
+    const int numPoints = 1000;
+    vector<double> x(numPoints);
+    for (int i = 0; i < numPoints; ++i)
+        x[i] = 0.4 + 1.2*i/(numPoints - 1);
+
+    runner.run("SmoothSegmentedFunction::calcValue/1000 points", [&]() {
+        double sum = 0;
+        for (const double xi : x) sum += curve->calcValue(xi);
+        Benchmark::keep(sum);
+    });
+}
+
+void benchmarkTables(Benchmark::Runner& runner)
+{
+    const int numRows = 1000;
+    const int numColumns = 40;
+    vector<string> labels;
+    for (int j = 0; j < numColumns; ++j)
+        labels.push_back("column" + to_string(j));
+    RowVector row(numColumns);
+    for (int j = 0; j < numColumns; ++j) row[j] = 0.1*j;
+
+    runner.run("DataTable_::appendRow/1000x40", [&]() {
+        TimeSeriesTable table;
+        table.setColumnLabels(labels);
+        for (int i = 0; i < numRows; ++i)
+            table.appendRow(0.01*i, row);
+        Benchmark::keep(double(table.getNumRows()));
+    });
+
+    TimeSeriesTable table;
+    table.setColumnLabels(labels);
+    for (int i = 0; i < numRows; ++i) {
+        for (int j = 0; j < numColumns; ++j)
+            row[j] = std::sin(0.01*i + j);
+        table.appendRow(0.01*i, row);
+    }
+
+    runner.run("STOFileAdapter::write/1000x40", [&]() {
+        STOFileAdapter::write(table, "benchmark_table.sto");
+    });
+    runner.run("STOFileAdapter::read/1000x40", [&]() {
+        Benchmark::keep(double(
+            STOFileAdapter::read("benchmark_table.sto").getNumRows()));
+    });
+    runner.run("CSVFileAdapter::write/1000x40", [&]() {
+        CSVFileAdapter::write(table, "benchmark_table.csv");
+    });
+    runner.run("CSVFileAdapter::read/1000x40", [&]() {
+        Benchmark::keep(double(
+            CSVFileAdapter::read("benchmark_table.csv").getNumRows()));
+    });
+}
+
+void printUsage()
+{
+    cout << "Usage: osimBenchmarks [options]\n"
+        "  --filter <text>      Only run benchmarks whose name contains text.\n"
+        "  --samples <n>        Number of timed samples (default 9).\n"
+        "  --min-time <s>       Minimum duration of a sample (default 0.05).\n"
+        "  --output <file>      Write the results as CSV to file.\n"
+        "  --baseline <file>    Compare with the results of an earlier run;\n"
+        "                       exit with 1 if any benchmark regressed.\n"
+        "  --tolerance <frac>   Allowed slowdown relative to the baseline\n"
+        "                       (default 0.1, i.e., 10%).\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    string filter, outputFile, baselineFile;
+    int numSamples = 9;
+    double minSampleTime = 0.05;
+    double tolerance = 0.1;
+
+    for (int i = 1; i < argc; ++i) {
+        const string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        }
+        if (i + 1 == argc) {
+            cerr << "Missing value for " << arg << "." << endl;
+            printUsage();
+            return 1;
+        }
+        const string value = argv[++i];
+        if (arg == "--filter") filter = value;
+        else if (arg == "--samples") numSamples = std::stoi(value);
+        else if (arg == "--min-time") minSampleTime = std::stod(value);
+        else if (arg == "--output") outputFile = value;
+        else if (arg == "--baseline") baselineFile = value;
+        else if (arg == "--tolerance") tolerance = std::stod(value);
+        else {
+            cerr << "Unrecognized option " << arg << "." << endl;
+            printUsage();
+            return 1;
+        }
+    }
+    if (numSamples < 1) {
+        cerr << "Expected at least 1 sample." << endl;
+        return 1;
+    }
+
+    try {
+        Benchmark::Runner runner(numSamples, minSampleTime, filter);
+        benchmarkArm26(runner);
+        benchmarkGait10dof18musc(runner);
+        benchmarkCurves(runner);
+        benchmarkTables(runner);
+
+        if (!outputFile.empty()) {
+#ifdef NDEBUG
+            const string buildType = "optimized";
+#else
+            const string buildType = "debug";
+#endif
+            runner.writeCSV(outputFile,
+                {"OpenSim " + GetVersion() + " (" + buildType + " build)"});
+            cout << "Wrote " << outputFile << "." << endl;
+        }
+
+        if (!baselineFile.empty()) {
+            const int numRegressions = Benchmark::compareToBaseline(
+                runner.getResults(), Benchmark::readBaseline(baselineFile),
+                tolerance, cout);
+            if (numRegressions > 0) {
+                cout << numRegressions << " benchmark(s) regressed." << endl;
+                return 1;
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        cerr << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -74,12 +74,15 @@ void
 AbstractDataTable::setDependentsMetaData(const DependentsMetaData& 
                                          dependentsMetaData) {
     _dependentsMetaData = dependentsMetaData;
+    updateColumnIndex();
     validateDependentsMetaData();
 }
 
 void
 AbstractDataTable::removeDependentsMetaDataForKey(const std::string& key) {
     _dependentsMetaData.removeValueForKey(key);
+    if(key == "labels")
+        updateColumnIndex();
 }
 
 bool
@@ -152,6 +155,7 @@ AbstractDataTable::setColumnLabel(const size_t columnIndex,
 
     _dependentsMetaData.removeValueArrayForKey("labels");
     _dependentsMetaData.setValueArrayForKey("labels", newLabels);
+    updateColumnIndex();
 
     validateDependentsMetaData();
 }
@@ -161,13 +165,11 @@ AbstractDataTable::getColumnIndex(const std::string& columnLabel) const {
     OPENSIM_THROW_IF(!hasColumnLabels(),
                      NoColumnLabels);
 
-    const auto& absArray = 
-        _dependentsMetaData.getValueArrayForKey("labels");
-    for(size_t i = 0; i < absArray.size(); ++i)
-        if(absArray[i].getValue<std::string>() == columnLabel)
-            return i;
+    const auto it = _columnIndex.find(columnLabel);
+    OPENSIM_THROW_IF(it == _columnIndex.end(),
+                     KeyNotFound, columnLabel);
 
-    OPENSIM_THROW(KeyNotFound, columnLabel);
+    return it->second;
 }
 
 bool 
@@ -175,13 +177,7 @@ AbstractDataTable::hasColumn(const std::string& columnLabel) const {
     OPENSIM_THROW_IF(!hasColumnLabels(),
                      NoColumnLabels);
 
-    const auto& absArray = 
-        _dependentsMetaData.getValueArrayForKey("labels");
-    for(size_t i = 0; i < absArray.size(); ++i)
-        if(absArray[i].getValue<std::string>() == columnLabel)
-            return true;
-
-    return false;
+    return _columnIndex.count(columnLabel) > 0;
 }
 
 bool 
@@ -194,8 +190,23 @@ AbstractDataTable::appendColumnLabel(const std::string& columnLabel) {
     auto& absArray = _dependentsMetaData.updValueArrayForKey("labels");
     auto& labels = static_cast<ValueArray<std::string>&>(absArray);
     labels.upd().push_back(SimTK::Value<std::string>{columnLabel});
+    _columnIndex.emplace(columnLabel, labels.size() - 1);
 
     validateDependentsMetaData();
 }
 
+void
+AbstractDataTable::updateColumnIndex() {
+    _columnIndex.clear();
+    if(!hasColumnLabels())
+        return;
+
+    const auto& absArray =
+        _dependentsMetaData.getValueArrayForKey("labels");
+    _columnIndex.reserve(absArray.size());
+    // emplace() keeps the first column of any duplicated label.
+    for(size_t i = 0; i < absArray.size(); ++i)
+        _columnIndex.emplace(absArray[i].getValue<std::string>(), i);
+}
+
 } // namespace OpenSim
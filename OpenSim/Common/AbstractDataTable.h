@@ -33,6 +33,7 @@ provide an in-memory container for data access and manipulation.              */
 #include "OpenSim/Common/ValueArrayDictionary.h"
 
 #include <ostream>
+#include <unordered_map>
 
 namespace OpenSim {
 
@@ -382,6 +383,7 @@ public:
             labels.upd().push_back(SimTK::Value<std::string>(*it));
         _dependentsMetaData.removeValueArrayForKey("labels");
         _dependentsMetaData.setValueArrayForKey("labels", labels);
+        updateColumnIndex();
 
         validateDependentsMetaData();
     }
@@ -464,6 +466,15 @@ protected:
     TableMetaData       _tableMetaData;
     DependentsMetaData  _dependentsMetaData;
     IndependentMetaData _independentMetaData;
+
+private:
+    /** Rebuild the column index from the column labels. To be called
+    whenever the column labels are replaced.                                  */
+    void updateColumnIndex();
+
+    // Index of the first column with each label, for constant time lookup of
+    // columns by label.
+    std::unordered_map<std::string, size_t> _columnIndex;
 }; // AbstractDataTable
 
 } // namespace OpenSim
@@ -214,6 +214,14 @@ public:
     If you already have a heap-allocated object you're willing to give up and
     want to avoid the extra copy, use adoptValueObject(). **/
     virtual void setValueAsObject(const Object& obj, int index=-1) = 0;
+    /** Append a heap-allocated object to the end of the list of values of an
+    object property, taking over ownership of it. The object must be of the
+    type stored by this property (or derived from it). Throws if this is not
+    an object property, if the object is of the wrong type, or if the list is
+    already of maximum size; the caller keeps ownership of the object in that
+    case.
+    @returns The index assigned to this value in the list. **/
+    virtual int adoptAndAppendValueAsObject(Object* obj) = 0;
     // Implementation of these non-virtual templatized methods must be 
     // deferred until the concrete property declarations are known. 
     // See Object.h.
@@ -26,6 +26,7 @@
 #include "DelimFileAdapter.h"
 #include "STOFileAdapter.h"
 #include "CSVFileAdapter.h"
+#include "BinarySTOFileAdapter.h"
 
 #ifdef WITH_BTK
 
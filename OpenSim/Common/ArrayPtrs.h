@@ -29,7 +29,13 @@
 
 
 #include "osimCommonDLL.h"
+#include <atomic>
 #include <iostream>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
 #include "Exception.h"
 
 
@@ -58,6 +64,25 @@
  */
 namespace OpenSim { 
 
+class Object;
+
+#ifndef SWIG
+/**
+ * Whether the index of the names of the objects in an ArrayPtrs is up to
+ * date. An ArrayPtrs that owns Objects gives each of them a pointer to its
+ * flag, which the Object clears when it is renamed (see Object::nameChanged()).
+ */
+class NameIndexFlag {
+public:
+    /** Mark the index as out of date. */
+    void invalidate() { _upToDate.store(false); }
+    /** Mark the index as up to date and return whether it already was. */
+    bool validate() { return _upToDate.exchange(true); }
+private:
+    std::atomic<bool> _upToDate{false};
+};
+#endif
+
 template<class T> class ArrayPtrs
 {
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -79,6 +104,26 @@ protected:
     /** Array of pointers to objects of type T. */
     T **_array;
 
+#ifndef SWIG
+private:
+    /** Arrays with fewer objects are searched by name without the index. */
+    static const int MinSizeForNameIndex = 16;
+    /** Index of the objects by name, built when first needed: the index of
+    the first object with each name, and whether other objects have the same
+    name. Only arrays that own Objects keep an index, since only they are
+    told when an object is renamed. */
+    mutable std::unordered_map<std::string, std::pair<int,bool>> _nameIndex;
+    /** Cleared when objects are inserted, removed, replaced or renamed. */
+    mutable NameIndexFlag _nameIndexFlag;
+    /** Number of objects, from the start of the array, in the index. Objects
+    appended since the index was built are added when it is next used. */
+    mutable int _nameIndexSize;
+    /** Serializes building and reading the index, since getIndex() is const
+    and may be called from several threads. */
+    mutable std::mutex _nameIndexMutex;
+protected:
+#endif
+
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 // METHODS
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -148,8 +193,98 @@ void setNull()
     _capacityIncrement = -1;
     _capacity = 0;
     _array = NULL;
+    invalidateNameIndex();
 }
 
+#ifndef SWIG
+//_____________________________________________________________________________
+/**
+ * Mark the index of names as out of date; it is rebuilt when next needed.
+ */
+void invalidateNameIndex()
+{
+    _nameIndexFlag.invalidate();
+}
+//_____________________________________________________________________________
+/**
+ * Give an object that this array owns the flag of the index of names, so
+ * that renaming the object invalidates the index, or take the flag back if
+ * this array no longer owns it. Only Objects are indexed.
+ */
+void trackName(T *aObject)
+{
+    trackName(aObject,std::is_base_of<Object,T>());
+}
+void trackName(T *aObject,std::true_type)
+{
+    if(aObject==NULL) return;
+    if(_memoryOwner) aObject->_ownerNameIndexFlag = &_nameIndexFlag;
+    else if(aObject->_ownerNameIndexFlag == &_nameIndexFlag)
+        aObject->_ownerNameIndexFlag = NULL;
+}
+void trackName(T*,std::false_type) {}
+//_____________________________________________________________________________
+/**
+ * Whether names are looked up in the index (see trackName()).
+ */
+bool usesNameIndex() const
+{
+    return(_memoryOwner && std::is_base_of<Object,T>::value &&
+           _size>=MinSizeForNameIndex);
+}
+//_____________________________________________________________________________
+/**
+ * Add the next object that is not yet in the index of names to the index.
+ * The caller must hold _nameIndexMutex.
+ */
+void addNextToNameIndex() const
+{
+    const int i = _nameIndexSize++;
+    const std::string& name = _array[i]->getName();
+    auto result = _nameIndex.insert(std::make_pair(name,std::make_pair(i,false)));
+    if(!result.second) result.first->second.second = true;
+}
+//_____________________________________________________________________________
+/**
+ * Bring the index of names up to date, adding the objects appended since it
+ * was last used, or rebuilding it if objects were inserted, removed, replaced
+ * or renamed. The caller must hold _nameIndexMutex.
+ */
+void updateNameIndex() const
+{
+    if(!_nameIndexFlag.validate()) {
+        _nameIndex.clear();
+        _nameIndex.reserve(_size);
+        _nameIndexSize = 0;
+    }
+    while(_nameIndexSize<_size) addNextToNameIndex();
+}
+//_____________________________________________________________________________
+/**
+ * Look up a name in the index of names.
+ *
+ * @return True if the index determined rIndex (-1 if there is no object
+ * with the name), false if the array must be searched instead.
+ */
+bool findInNameIndex(const std::string &aName,int aStartIndex,
+                     int &rIndex) const
+{
+    std::lock_guard<std::mutex> lock(_nameIndexMutex);
+    updateNameIndex();
+
+    auto it = _nameIndex.find(aName);
+    if(it == _nameIndex.end()) {
+        rIndex = -1;
+        return(true);
+    }
+    // With several objects of the same name, which one is found depends on
+    // where the search starts.
+    if(it->second.second && aStartIndex>0) return(false);
+    rIndex = it->second.first;
+    return(true);
+}
+#endif
+
 public:
 //_____________________________________________________________________________
 /**
@@ -170,6 +305,7 @@ void clearAndDestroy()
     }
 
     _size = 0;
+    invalidateNameIndex();
 }
 
 
@@ -213,6 +349,8 @@ ArrayPtrs<T>& operator=(const ArrayPtrs<T> &aArray)
 
     // TAKE OWNERSHIP OF MEMORY
     _memoryOwner = true;
+    for(i=0;i<_size;i++) trackName(_array[i]);
+    invalidateNameIndex();
 
     return(*this);
 }
@@ -315,6 +453,8 @@ friend std::ostream& operator<<(std::ostream &aOut,const ArrayPtrs<T> &aArray)
 void setMemoryOwner(bool aTrueFalse)
 {
     _memoryOwner = aTrueFalse;
+    for(int i=0;i<_size;i++) trackName(_array[i]);
+    invalidateNameIndex();
 }
 //_____________________________________________________________________________
 /**
@@ -528,6 +668,7 @@ bool setSize(int aSize)
             }
         }
         _size = aSize;
+        invalidateNameIndex();
     }
 
     return(true);
@@ -582,6 +723,10 @@ int getIndex(ConstT *aObject,int aStartIndex=0) const
 /**
  * Get the index of an object by specifying its name.
  *
+ * Large arrays keep an index of the names of their objects, so that the
+ * search takes constant time. The index is kept up to date as objects are
+ * added, removed, and renamed.
+ *
  * @param aName Name of the object whose index is sought.
  * @param aStartIndex Index at which to start searching.  If the object is
  * not found at or following aStartIndex, the array is searched from
@@ -594,6 +739,10 @@ int getIndex(const std::string &aName,int aStartIndex=0) const
     if(aStartIndex<0) aStartIndex=0;
     if(aStartIndex>=getSize()) aStartIndex=0;
 
+    int index;
+    if(usesNameIndex() &&
+       findInNameIndex(aName,aStartIndex,index)) return(index);
+
     // SEARCH STARTING FROM aStartIndex
     int i;
     for(i=aStartIndex;i<getSize();i++) {
@@ -638,6 +787,7 @@ bool append(T *aObject)
     // SET
     _array[_size] = aObject;
     _size++;
+    trackName(aObject);
 
     return(true);
 }
@@ -718,6 +868,8 @@ bool insert(int aIndex,T *aObject)
     // SET
     _array[aIndex] = aObject;
     _size++;
+    trackName(aObject);
+    invalidateNameIndex();
 
     return(true);
 }
@@ -758,6 +910,7 @@ bool remove(int aIndex)
         _array[i] = _array[i+1];
     }
     _array[_size] = NULL;
+    invalidateNameIndex();
 
     return(true);
 }
@@ -814,6 +967,8 @@ bool set(int aIndex,T *aObject)
     // SET
     if(getMemoryOwner() && (_array[aIndex]!=NULL)) delete _array[aIndex];
     _array[aIndex] = aObject;
+    trackName(aObject);
+    invalidateNameIndex();
 
     return(true);
 }
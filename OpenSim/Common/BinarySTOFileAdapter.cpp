@@ -0,0 +1,261 @@
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  BinarySTOFileAdapter.cpp                      *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "BinarySTOFileAdapter.h"
+#include "STOFileAdapter.h"
+
+namespace OpenSim {
+
+namespace {
+const char magic[8] = {'O', 'S', 'I', 'M', 'S', 'T', 'O', 'B'};
+const std::uint32_t version = 1;
+const std::uint32_t byteOrderMark = 0x01020304;
+// Upper bound on the length of the strings in a header, so that a corrupt
+// file cannot make us allocate an absurd amount of memory.
+const std::uint32_t maxStringLength = 1u << 24;
+
+template<typename U>
+void writeValue(std::ofstream& stream, const U& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(U));
+}
+
+void writeString(std::ofstream& stream, const std::string& str) {
+    writeValue(stream, static_cast<std::uint32_t>(str.size()));
+    stream.write(str.data(), str.size());
+}
+
+template<typename U>
+U readValue(std::ifstream& stream, const std::string& fileName) {
+    U value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(U));
+    OPENSIM_THROW_IF(!stream, IOError,
+                     "Unexpected end of file '" + fileName + "'.");
+    return value;
+}
+
+std::string readString(std::ifstream& stream, const std::string& fileName) {
+    const auto size = readValue<std::uint32_t>(stream, fileName);
+    OPENSIM_THROW_IF(size > maxStringLength, IOError,
+                     "File '" + fileName + "' is corrupt.");
+    std::string str(size, '\0');
+    if(size > 0)
+        stream.read(&str[0], size);
+    OPENSIM_THROW_IF(!stream, IOError,
+                     "Unexpected end of file '" + fileName + "'.");
+    return str;
+}
+
+// Offset of the data: the header is padded to a multiple of 8 bytes.
+std::streamoff alignedOffset(std::streamoff offset) {
+    return (offset + 7) / 8 * 8;
+}
+} // anonymous namespace
+
+BinarySTOFileAdapter*
+BinarySTOFileAdapter::clone() const {
+    return new BinarySTOFileAdapter{*this};
+}
+
+BinarySTOFileAdapter::Header
+BinarySTOFileAdapter::readHeader(const std::string& fileName) {
+    std::ifstream stream{fileName, std::ios::in | std::ios::binary};
+    return readHeader(stream, fileName);
+}
+
+BinarySTOFileAdapter::Header
+BinarySTOFileAdapter::readHeader(std::ifstream& stream,
+                                 const std::string& fileName) {
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+    OPENSIM_THROW_IF(!stream.good(),
+                     FileDoesNotExist,
+                     fileName);
+
+    char fileMagic[sizeof(magic)] = {};
+    stream.read(fileMagic, sizeof(magic));
+    OPENSIM_THROW_IF(!stream || !std::equal(magic, magic + sizeof(magic),
+                                            fileMagic),
+                     IOError,
+                     "File '" + fileName + "' is not a binary STO file.");
+    const auto fileVersion = readValue<std::uint32_t>(stream, fileName);
+    OPENSIM_THROW_IF(fileVersion > version, IOError,
+                     "File '" + fileName + "' has version " +
+                     std::to_string(fileVersion) + ", but at most version " +
+                     std::to_string(version) + " is supported.");
+    OPENSIM_THROW_IF(readValue<std::uint32_t>(stream, fileName) !=
+                     byteOrderMark, IOError,
+                     "File '" + fileName + "' was written on a machine with "
+                     "a different byte order.");
+
+    Header header{};
+    header.dataType = readString(stream, fileName);
+    header.numComponents = readValue<std::uint32_t>(stream, fileName);
+    header.numRows = static_cast<size_t>(
+            readValue<std::uint64_t>(stream, fileName));
+    header.numColumns = static_cast<size_t>(
+            readValue<std::uint64_t>(stream, fileName));
+    const auto numMetaData = readValue<std::uint32_t>(stream, fileName);
+    for(std::uint32_t i = 0; i < numMetaData; ++i) {
+        auto key = readString(stream, fileName);
+        auto value = readString(stream, fileName);
+        header.metaData.emplace_back(std::move(key), std::move(value));
+    }
+    for(size_t c = 0; c < header.numColumns; ++c)
+        header.columnLabels.push_back(readString(stream, fileName));
+    header.dataOffset = alignedOffset(stream.tellg());
+
+    // Make sure the file holds all of the data it claims to hold.
+    stream.seekg(0, std::ios::end);
+    const std::streamoff expectedSize = header.dataOffset +
+        static_cast<std::streamoff>(header.numRows*sizeof(double)*
+                        (1 + header.numColumns*header.numComponents));
+    OPENSIM_THROW_IF(stream.tellg() < expectedSize, IOError,
+                     "File '" + fileName + "' is truncated.");
+
+    return header;
+}
+
+void
+BinarySTOFileAdapter::writeHeader(std::ofstream& stream,
+                                  const AbstractDataTable& table,
+                                  const std::string& dataType,
+                                  unsigned numComponents,
+                                  size_t numRows) {
+    stream.write(magic, sizeof(magic));
+    writeValue(stream, version);
+    writeValue(stream, byteOrderMark);
+    writeString(stream, dataType);
+    writeValue(stream, static_cast<std::uint32_t>(numComponents));
+    writeValue(stream, static_cast<std::uint64_t>(numRows));
+    writeValue(stream, static_cast<std::uint64_t>(table.getNumColumns()));
+
+    // As in STO files, only metadata whose values are strings is written.
+    std::vector<std::pair<std::string, std::string>> metaData{};
+    for(const auto& key : table.getTableMetaDataKeys()) {
+        try {
+            metaData.emplace_back(key,
+                    table.getTableMetaData<std::string>(key));
+        } catch(const InvalidTemplateArgument&) {}
+    }
+    writeValue(stream, static_cast<std::uint32_t>(metaData.size()));
+    for(const auto& keyValue : metaData) {
+        writeString(stream, keyValue.first);
+        writeString(stream, keyValue.second);
+    }
+    for(const auto& label : table.getColumnLabels())
+        writeString(stream, label);
+
+    const std::streamoff offset = stream.tellp();
+    for(std::streamoff i = offset; i < alignedOffset(offset); ++i)
+        stream.put('\0');
+}
+
+void
+BinarySTOFileAdapter::readDoubles(std::ifstream& stream,
+                                  const std::string& fileName,
+                                  std::streamoff offset,
+                                  double* values, size_t count) {
+    if(count == 0)
+        return;
+    stream.clear();
+    stream.seekg(offset);
+    stream.read(reinterpret_cast<char*>(values), count*sizeof(double));
+    OPENSIM_THROW_IF(!stream, IOError,
+                     "Unexpected end of file '" + fileName + "'.");
+}
+
+DataAdapter::OutputTables
+BinarySTOFileAdapter::extendRead(const std::string& fileName) const {
+    using namespace SimTK;
+
+    const auto dataType = readHeader(fileName).dataType;
+    std::shared_ptr<AbstractDataTable> table{};
+    if(dataType == "double")
+        table.reset(new TimeSeriesTable_<double>(read<double>(fileName)));
+    else if(dataType == "Vec2")
+        table.reset(new TimeSeriesTable_<Vec2>(read<Vec2>(fileName)));
+    else if(dataType == "Vec3")
+        table.reset(new TimeSeriesTable_<Vec3>(read<Vec3>(fileName)));
+    else if(dataType == "Vec4")
+        table.reset(new TimeSeriesTable_<Vec4>(read<Vec4>(fileName)));
+    else if(dataType == "Vec5")
+        table.reset(new TimeSeriesTable_<Vec5>(read<Vec5>(fileName)));
+    else if(dataType == "Vec6")
+        table.reset(new TimeSeriesTable_<Vec6>(read<Vec6>(fileName)));
+    else if(dataType == "UnitVec3")
+        table.reset(new TimeSeriesTable_<UnitVec3>(read<UnitVec3>(fileName)));
+    else if(dataType == "Quaternion")
+        table.reset(new TimeSeriesTable_<Quaternion>(
+                read<Quaternion>(fileName)));
+    else if(dataType == "SpatialVec")
+        table.reset(new TimeSeriesTable_<SpatialVec>(
+                read<SpatialVec>(fileName)));
+    else
+        OPENSIM_THROW(STODataTypeNotSupported,
+                      dataType);
+
+    OutputTables output_tables{};
+    output_tables.emplace(tableString(), table);
+    return output_tables;
+}
+
+void
+BinarySTOFileAdapter::extendWrite(const InputTables& absTables,
+                                  const std::string& fileName) const {
+    using namespace SimTK;
+
+    OPENSIM_THROW_IF(absTables.empty(),
+                     NoTableFound);
+    const AbstractDataTable* absTable{};
+    try {
+        absTable = absTables.at(tableString());
+    } catch(std::out_of_range&) {
+        OPENSIM_THROW(KeyMissing,
+                      tableString());
+    }
+
+    // Try derived class before base class.
+    if(auto t = dynamic_cast<const TimeSeriesTable_<UnitVec3>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<Quaternion>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<SpatialVec>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<double>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<Vec2>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<Vec3>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<Vec4>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<Vec5>*>(absTable))
+        write(*t, fileName);
+    else if(auto t = dynamic_cast<const TimeSeriesTable_<Vec6>*>(absTable))
+        write(*t, fileName);
+    else
+        OPENSIM_THROW(IncorrectTableType,
+                      "Binary STO files hold TimeSeriesTable_ of double, "
+                      "Vec2 to Vec6, UnitVec3, Quaternion or SpatialVec.");
+}
+
+} // namespace OpenSim
@@ -0,0 +1,256 @@
+/* -------------------------------------------------------------------------- *
+ *                     OpenSim:  BinarySTOFileAdapter.h                       *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OPENSIM_BINARY_STO_FILE_ADAPTER_H_
+#define OPENSIM_BINARY_STO_FILE_ADAPTER_H_
+
+#include "DelimFileAdapter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+
+namespace OpenSim {
+
+/** BinarySTOFileAdapter reads and writes TimeSeriesTable_ objects in a binary,
+column-oriented file format (extension ".stob"). Values are stored exactly
+(no conversion to text), so tables round-trip without any loss of precision,
+and files are smaller and much faster to read and write than STO files.
+
+The file holds a header followed by the data:
+\code
+header:  "OSIMSTOB" | version | byte order mark | DataType | components per
+         element | number of rows | number of columns | table metadata
+         (key-value pairs) | column labels
+data:    time column | column 0 | column 1 | ... (each column is contiguous,
+         and starts at a multiple of 8 bytes from the start of the file)
+\endcode
+Because the columns are stored one after another, read() can load a subset
+of the columns over a range of times by reading just those bytes of the file,
+without parsing (or even reading) the rest of it.
+
+Like STO files, the table metadata (only values of type std::string) and the
+column labels are stored; DataType tells the type of the table, which may be
+TimeSeriesTable_<T> with T any of: double, SimTK::Vec2 to SimTK::Vec6,
+SimTK::UnitVec3, SimTK::Quaternion and SimTK::SpatialVec. Files are written
+in the byte order of the machine that writes them, and can only be read on
+machines with the same byte order.
+
+Example:
+\code
+BinarySTOFileAdapter::write(table, "states.stob");
+// The knee angle over the swing phase only.
+auto swing = BinarySTOFileAdapter::read<double>("states.stob",
+                                                {"knee/knee_angle/value"},
+                                                0.6, 1.0);
+\endcode
+The file can also be read with FileAdapter::readFile() and TimeSeriesTable_'s
+file name constructor.                                                        */
+class OSIMCOMMON_API BinarySTOFileAdapter : public FileAdapter {
+public:
+    BinarySTOFileAdapter()                                       = default;
+    BinarySTOFileAdapter(const BinarySTOFileAdapter&)            = default;
+    BinarySTOFileAdapter(BinarySTOFileAdapter&&)                 = default;
+    BinarySTOFileAdapter& operator=(const BinarySTOFileAdapter&) = default;
+    BinarySTOFileAdapter& operator=(BinarySTOFileAdapter&&)      = default;
+    ~BinarySTOFileAdapter()                                      = default;
+
+    BinarySTOFileAdapter* clone() const override;
+
+    /** Key used for table associative array returned/accepted by write/read. */
+    static const std::string tableString() { return "table"; }
+
+    /** The header of a file, as read by readHeader().                        */
+    struct Header {
+        std::string dataType;
+        unsigned numComponents;
+        size_t numRows;
+        size_t numColumns;
+        std::vector<std::pair<std::string, std::string>> metaData;
+        std::vector<std::string> columnLabels;
+        /** Offset in the file of the time column, in bytes. The column with
+        index i starts (1 + i*numComponents)*numRows*8 bytes later.           */
+        std::streamoff dataOffset;
+    };
+
+    /** Read the header of a file without reading any of its data.            */
+    static Header readHeader(const std::string& fileName);
+
+    /** Read a file. The DataType of the file must match T.                   */
+    template<typename T>
+    static TimeSeriesTable_<T> read(const std::string& fileName) {
+        return read<T>(fileName, {});
+    }
+
+    /** Read part of a file: the columns with the given labels (all columns if
+    no labels are given) in the rows whose times are within [startTime,
+    endTime]. Only the time column and those parts of the requested columns
+    are read from the file. The DataType of the file must match T.            */
+    template<typename T>
+    static TimeSeriesTable_<T> read(const std::string& fileName,
+                                    const std::vector<std::string>& labels,
+                                    double startTime = -SimTK::Infinity,
+                                    double endTime = SimTK::Infinity);
+
+    /** Write a file.                                                         */
+    template<typename T>
+    static void write(const TimeSeriesTable_<T>& table,
+                      const std::string& fileName);
+
+protected:
+    /** Implementation of the read functionality.                             */
+    OutputTables extendRead(const std::string& fileName) const override;
+
+    /** Implementation of the write functionality.                            */
+    void extendWrite(const InputTables& tables,
+                     const std::string& fileName) const override;
+
+private:
+    /** Open a file for reading and read its header.                          */
+    static Header readHeader(std::ifstream& stream,
+                             const std::string& fileName);
+
+    /** Write the header of a table. The stream is left at the offset at which
+    the time column is to be written.                                         */
+    static void writeHeader(std::ofstream& stream,
+                            const AbstractDataTable& table,
+                            const std::string& dataType,
+                            unsigned numComponents,
+                            size_t numRows);
+
+    /** Read count doubles from the stream starting at the given offset.      */
+    static void readDoubles(std::ifstream& stream,
+                            const std::string& fileName,
+                            std::streamoff offset,
+                            double* values, size_t count);
+};
+
+template<typename T>
+TimeSeriesTable_<T>
+BinarySTOFileAdapter::read(const std::string& fileName,
+                           const std::vector<std::string>& labels,
+                           double startTime,
+                           double endTime) {
+    // The elements of all supported types are arrays of doubles.
+    constexpr unsigned numComponents = sizeof(T)/sizeof(double);
+    static_assert(sizeof(T) == numComponents*sizeof(double),
+                  "Elements must be contiguous arrays of doubles.");
+
+    std::ifstream stream{fileName, std::ios::in | std::ios::binary};
+    const Header header = readHeader(stream, fileName);
+    OPENSIM_THROW_IF(header.dataType != DelimFileAdapter<T>::dataTypeName(),
+                     DataTypeMismatch,
+                     DelimFileAdapter<T>::dataTypeName(),
+                     header.dataType);
+
+    // Columns to read.
+    std::vector<size_t> columns{};
+    if(labels.empty()) {
+        for(size_t c = 0; c < header.numColumns; ++c)
+            columns.push_back(c);
+    } else {
+        for(const auto& label : labels) {
+            auto found = std::find(header.columnLabels.begin(),
+                                   header.columnLabels.end(), label);
+            OPENSIM_THROW_IF(found == header.columnLabels.end(),
+                             KeyNotFound, label);
+            columns.push_back(found - header.columnLabels.begin());
+        }
+    }
+
+    // Rows to read.
+    std::vector<double> times(header.numRows);
+    readDoubles(stream, fileName, header.dataOffset,
+                times.data(), times.size());
+    const size_t first = std::lower_bound(times.begin(), times.end(),
+                                          startTime) - times.begin();
+    const size_t last = std::upper_bound(times.begin(), times.end(),
+                                         endTime) - times.begin();
+    const size_t numRows = last > first ? last - first : 0;
+
+    SimTK::Matrix_<T> data(static_cast<int>(numRows),
+                           static_cast<int>(columns.size()));
+    std::vector<T> column(numRows);
+    const std::streamoff columnSize = static_cast<std::streamoff>(
+            header.numRows*numComponents*sizeof(double));
+    for(size_t c = 0; c < columns.size(); ++c) {
+        const std::streamoff offset = header.dataOffset +
+            static_cast<std::streamoff>(header.numRows*sizeof(double)) +
+            static_cast<std::streamoff>(columns[c])*columnSize +
+            static_cast<std::streamoff>(first*numComponents*sizeof(double));
+        // Read the raw values in place; this also keeps elements like
+        // Quaternion from being normalized on the way in.
+        readDoubles(stream, fileName, offset,
+                    reinterpret_cast<double*>(column.data()),
+                    numRows*numComponents);
+        for(size_t r = 0; r < numRows; ++r)
+            data.updElt(static_cast<int>(r), static_cast<int>(c)) = column[r];
+    }
+
+    std::vector<std::string> columnLabels{};
+    for(auto c : columns)
+        columnLabels.push_back(header.columnLabels[c]);
+    TimeSeriesTable_<T> table{
+        std::vector<double>(times.begin() + first, times.begin() + last),
+        data, columnLabels};
+    for(const auto& keyValue : header.metaData)
+        table.updTableMetaData().setValueForKey(keyValue.first,
+                                                keyValue.second);
+    return table;
+}
+
+template<typename T>
+void
+BinarySTOFileAdapter::write(const TimeSeriesTable_<T>& table,
+                            const std::string& fileName) {
+    // The elements of all supported types are arrays of doubles.
+    constexpr unsigned numComponents = sizeof(T)/sizeof(double);
+    static_assert(sizeof(T) == numComponents*sizeof(double),
+                  "Elements must be contiguous arrays of doubles.");
+    OPENSIM_THROW_IF(fileName.empty(),
+                     EmptyFileName);
+
+    std::ofstream stream{fileName, std::ios::out | std::ios::binary};
+    OPENSIM_THROW_IF(!stream.good(), IOError,
+                     "Could not open file '" + fileName + "' for writing.");
+    const size_t numRows = table.getNumRows();
+    writeHeader(stream, table, DelimFileAdapter<T>::dataTypeName(),
+                numComponents, numRows);
+
+    const auto& times = table.getIndependentColumn();
+    stream.write(reinterpret_cast<const char*>(times.data()),
+                 numRows*sizeof(double));
+    std::vector<T> column(numRows);
+    for(size_t c = 0; c < table.getNumColumns(); ++c) {
+        const auto values = table.getDependentColumnAtIndex(c);
+        for(size_t r = 0; r < numRows; ++r)
+            column[r] = values[static_cast<int>(r)];
+        stream.write(reinterpret_cast<const char*>(column.data()),
+                     numRows*numComponents*sizeof(double));
+    }
+    OPENSIM_THROW_IF(!stream.good(), IOError,
+                     "Could not write file '" + fileName + "'.");
+}
+
+} // namespace OpenSim
+
+#endif // OPENSIM_BINARY_STO_FILE_ADAPTER_H_
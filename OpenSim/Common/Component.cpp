@@ -26,6 +26,7 @@
 #include "Component.h"
 #include "OpenSim/Common/IO.h"
 #include "XMLDocument.h"
+#include <atomic>
 #include <unordered_map>
 #include <set>
 
@@ -690,7 +691,11 @@ void Component::setOwner(const Component& owner)
         return;
     }
 
+    // This subtree leaves the tree of its previous owner, if any.
+    if (hasOwner())
+        getOwner().invalidatePathIndex();
     _owner.reset(&owner);
+    invalidatePathIndex();
 }
 
 std::string Component::getAbsolutePathString() const
@@ -1148,6 +1153,9 @@ void Component::markPropertiesAsSubcomponents()
     // Method can be invoked for either constructing a new Component
     // or the properties have been modified. In the latter case
     // we must make sure that pointers to old properties are cleared
+    std::vector<const Component*> previousSubcomponents;
+    for (const auto& comp : _propertySubcomponents)
+        previousSubcomponents.push_back(comp.get());
     _propertySubcomponents.clear();
 
     // Now mark properties that are Components as subcomponents
@@ -1188,6 +1196,13 @@ void Component::markPropertiesAsSubcomponents()
             } // loop over the property list
         } // end if property is an Object
     } // loop over properties
+
+    // Usually the same components are marked again; only invalidate path
+    // indices if they are not.
+    bool changed = previousSubcomponents.size() != _propertySubcomponents.size();
+    for (size_t i = 0; !changed && i < previousSubcomponents.size(); ++i)
+        changed = previousSubcomponents[i] != _propertySubcomponents[i].get();
+    if (changed) invalidatePathIndex();
 }
 
 // mark a Component as a subcomponent of this one. If already a
@@ -1238,6 +1253,103 @@ void Component::adoptSubcomponent(Component* subcomponent)
 
     subcomponent->setOwner(*this);
     _adoptedSubcomponents.push_back(SimTK::ClonePtr<Component>(subcomponent));
+    invalidatePathIndex();
+}
+
+void Component::invalidatePathIndex() const
+{
+    // An index covers the subtree of the Component that built it, so every
+    // Component from this one up to the root has an out-of-date index.
+    for (const Component* comp = this; ; comp = &comp->getOwner()) {
+        comp->_pathIndex.generation.fetch_add(1, std::memory_order_relaxed);
+        if (!comp->hasOwner())
+            break;
+    }
+}
+
+bool Component::findInPathIndex(const ComponentPath& path, size_t first,
+                                const Component*& found) const
+{
+    const Component* root = this;
+    while (root->hasOwner())
+        root = &root->getOwner();
+
+    std::string key = getAbsolutePathString();
+
+    std::lock_guard<std::mutex> lock(root->_pathIndex.mutex);
+    root->updatePathIndex();
+    const auto& byPath = root->_pathIndex.byPath;
+
+    auto it = byPath.find(key);
+    if (it == byPath.end() || it->second != this)
+        return false;
+
+    for (size_t i = first; i < path.getNumPathLevels(); ++i)
+        key += "/" + path.getSubcomponentNameAtLevel(i);
+    it = byPath.find(key);
+    found = it == byPath.end() ? nullptr : it->second;
+    return true;
+}
+
+std::vector<const Component*>
+    Component::findSubcomponentsInNameIndex(const std::string& name) const
+{
+    const Component* root = this;
+    while (root->hasOwner())
+        root = &root->getOwner();
+
+    std::vector<const Component*> subcomponents;
+    std::lock_guard<std::mutex> lock(root->_pathIndex.mutex);
+    root->updatePathIndex();
+    const auto& byName = root->_pathIndex.byName;
+    const auto it = byName.find(name);
+    if (it == byName.end())
+        return subcomponents;
+
+    for (const Component* comp : it->second) {
+        // Keep the components that are under this one.
+        for (const Component* up = comp; up->hasOwner(); ) {
+            up = &up->getOwner();
+            if (up == this) {
+                subcomponents.push_back(comp);
+                break;
+            }
+        }
+    }
+    return subcomponents;
+}
+
+void Component::updatePathIndex() const
+{
+    const long long generation =
+        _pathIndex.generation.load(std::memory_order_relaxed);
+    if (_pathIndex.builtGeneration == generation)
+        return;
+
+    _pathIndex.byPath.clear();
+    _pathIndex.byName.clear();
+
+    // Visit the components in the order of getComponentList(), i.e., depth
+    // first through the member, property, and adopted subcomponents. Path
+    // is empty for components that cannot be reached by path.
+    std::function<void(const Component&, const std::string&)> add =
+        [&](const Component& comp, const std::string& path) {
+        _pathIndex.byName[comp.getName()].push_back(&comp);
+        std::string subPath;
+        if (!path.empty() && _pathIndex.byPath.emplace(path, &comp).second)
+            subPath = path + "/";
+        for (const auto& sub : comp._memberSubcomponents)
+            add(*sub, subPath.empty() ? "" : subPath + sub->getName());
+        for (const auto& sub : comp._propertySubcomponents)
+            add(*sub, subPath.empty() ? "" : subPath + sub->getName());
+        for (const auto& sub : comp._adoptedSubcomponents)
+            add(*sub, subPath.empty() ? "" : subPath + sub->getName());
+    };
+    _pathIndex.byPath.emplace("/" + getName(), this);
+    for (const auto& sub : getImmediateSubcomponents())
+        add(*sub, "/" + getName() + "/" + sub->getName());
+
+    _pathIndex.builtGeneration = generation;
 }
 
 std::vector<SimTK::ReferencePtr<const Component>> 
@@ -1430,6 +1542,11 @@ void Component::extendRealizeTopology(SimTK::State& s) const
                (s, ci.dependsOnStage, ci.prototype->clone());
         }
     }
+
+    // Allocate the Cache Entries that memoize the values of the Outputs
+    for (const auto& it : _outputsTable) {
+        it.second->allocateCacheEntries(s, subSys.getMySubsystemIndex());
+    }
 }
 
 
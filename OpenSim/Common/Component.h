@@ -49,7 +49,10 @@
 #include "OpenSim/Common/Array.h"
 #include "ComponentList.h"
 #include "ComponentPath.h"
+#include <atomic>
 #include <functional>
+#include <mutex>
+#include <unordered_map>
 
 #include "simbody/internal/MultibodySystem.h"
 
@@ -2233,9 +2236,12 @@ protected:
                 foundCs.push_back(found);
         }
 
-        ComponentList<const C> compsList = this->template getComponentList<C>();
-        
-        for (const C& comp : compsList) {
+        // Only components named subname can match, so look them up rather
+        // than search the whole tree.
+        for (const Component* sub : findSubcomponentsInNameIndex(subname)) {
+            const C* asC = dynamic_cast<const C*>(sub);
+            if (!asC) continue;
+            const C& comp = *asC;
             // if a child of this Component, one should not need
             // to specify this Component's absolute path name
             ComponentPath compAbsPath = comp.getAbsolutePath();
@@ -2320,6 +2326,11 @@ protected:
             }
         }
         
+        // Look the rest of the path up in the index of the root, if we can.
+        const Component* found = nullptr;
+        if (current->findInPathIndex(path, iPathEltStart, found))
+            return dynamic_cast<const C*>(found);
+
         using RefComp = SimTK::ReferencePtr<const Component>;
 
         // Skip over the root component name.
@@ -2576,6 +2587,33 @@ private:
     // Component by virtue of being one of its properties.
     void markAsPropertySubcomponent(const Component* subcomponent);
 
+    // Resolve the given path, starting at its element `first`, from this
+    // Component using the path index of the root of the tree. Returns false
+    // if the index cannot be used from this Component (because an earlier
+    // sibling of it or of one of its owners has the same name); otherwise,
+    // found is set to the component at the path, or nullptr if there is none.
+    bool findInPathIndex(const ComponentPath& path, size_t first,
+                         const Component*& found) const;
+
+    // The components with the given name under this Component (excluding
+    // this Component), in the order of getComponentList().
+    std::vector<const Component*> findSubcomponentsInNameIndex(
+            const std::string& name) const;
+
+    // (Re)build the path index of this Component if it is out of date. The
+    // mutex of the index must be locked.
+    void updatePathIndex() const;
+
+    // Mark the path indices of this Component and of its owners, up to the
+    // root of the tree, as out of date. Called when a subcomponent is added
+    // or removed, or a Component is renamed, within the subtree.
+    void invalidatePathIndex() const;
+
+    void nameChanged() override {
+        Super::nameChanged();
+        invalidatePathIndex();
+    }
+
     /// Invoke finalizeFromProperties() on the (sub)components of this Component.
     void componentsFinalizeFromProperties() const;
 
@@ -2793,6 +2831,34 @@ private:
     // tree order of its subcomponents.
     mutable std::vector<SimTK::ReferencePtr<const Component> > _orderedSubcomponents;
 
+#ifndef SWIG
+    // Index of the components in the tree under this Component, used (only)
+    // when this is the root of the tree to resolve paths and names without
+    // walking the tree. It is built on first use and rebuilt once generation,
+    // which invalidatePathIndex() increments for changes within this subtree,
+    // differs from the generation it was built for. Copies start out with an
+    // empty index.
+    struct PathIndex {
+        PathIndex() = default;
+        PathIndex(const PathIndex&) {}
+        PathIndex& operator=(const PathIndex&) {
+            byPath.clear();
+            byName.clear();
+            builtGeneration = -1;
+            return *this;
+        }
+        // Components by absolute path. Of siblings with the same name, only
+        // the first (and its subtree) is reachable, as when walking the tree.
+        std::unordered_map<std::string, const Component*> byPath;
+        // Components by name, in the order of getComponentList().
+        std::unordered_map<std::string, std::vector<const Component*>> byName;
+        std::atomic<long long> generation{0};
+        long long builtGeneration{-1};
+        std::mutex mutex;
+    };
+    mutable PathIndex _pathIndex;
+#endif
+
     // Structure to hold modeling option information. Modeling options are
     // integers 0..maxOptionValue. At run time we keep them in a Simbody
     // discrete state variable that invalidates Model stage if changed.
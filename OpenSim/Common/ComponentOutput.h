@@ -34,6 +34,7 @@
 #include "Exception.h"
 #include "Object.h"
 
+#include <algorithm>
 #include <functional>
 #include <map>
 
@@ -89,7 +90,10 @@ public:
  * An Output is intended to lightweight and adds no computational overhead
  * if the output goes unused. When an Output's value is called upon,
  * the overhead is a single redirect to the corresponding member function
- * for the value.
+ * for the value. The value is memoized in a cache entry of the State, so
+ * that reading the same Output again from an unchanged State does not call
+ * the member function again, and Outputs can be evaluated concurrently on
+ * separate States.
  *
  * An Output can either be a single-value Output or a list Output. A list Output
  * is one that can have multiple Channels. The Channels are what get connected
@@ -150,9 +154,26 @@ protected:
         _owner.reset(&owner);
     }
 
+    // The stage on which the memoized value of this Output depends. Outputs
+    // may read state variables even if they depend on a lower stage (e.g.,
+    // an Output for a state variable depends on Stage::Model), and changing
+    // a state variable invalidates at most Stage::Dynamics, so values are
+    // memoized only once the State has been realized through Dynamics.
+    SimTK::Stage getMemoizationStage() const {
+        const SimTK::Stage stage = 
+            std::max(getDependsOnStage(), SimTK::Stage(SimTK::Stage::Dynamics));
+        return std::min(stage, SimTK::Stage(SimTK::Stage::Report));
+    }
+
     SimTK::ReferencePtr<const Component> _owner;
 
 private:
+    // Allocate the cache entries that hold the values of the channels of
+    // this Output, in the subsystem of the owner. Called by the owner when
+    // it realizes Topology.
+    virtual void allocateCacheEntries(SimTK::State& state,
+            SimTK::SubsystemIndex subsystemIndex) const = 0;
+
     std::string name;
     SimTK::Stage dependsOnStage;
     unsigned int _numSigFigs = 8;
@@ -289,8 +310,7 @@ public:
                     state.getSystemStage(), getDependsOnStage(),
                     "Output::getValue(state)");
         }
-        _outputFcn(_owner.get(), state, "", _result);
-        return _result;
+        return _channels.begin()->second.getValue(state);
     }
     
     std::string getTypeName() const override {
@@ -318,7 +338,15 @@ public:
     }
 
 private:
-    mutable T _result;
+    void allocateCacheEntries(SimTK::State& state,
+            SimTK::SubsystemIndex subsystemIndex) const override {
+        for (const auto& it : _channels) {
+            it.second._subsystemIndex = subsystemIndex;
+            it.second._cacheIndex = state.allocateLazyCacheEntry(
+                    subsystemIndex, getMemoizationStage(), new SimTK::Value<T>());
+        }
+    }
+
     std::function<void (const Component*,
                         const SimTK::State&,
                         const std::string& channel,
@@ -337,10 +365,29 @@ public:
     Channel() = default;
     Channel(const Output<T>* output, const std::string& channelName)
      : _output(output), _channelName(channelName) {}
+    /** The value of this channel is memoized in the State, and it is
+    computed again only after the State has changed.
+    @throws Exception if the Component of this channel is not part of a
+    System (see Component::initSystem()). */
     const T& getValue(const SimTK::State& state) const {
-        // Must cache, since we're returning a reference.
-        _output->_outputFcn(_output->_owner.get(), state, _channelName, _result);
-        return _result;
+        // The value is held only by the State, never by this channel, so
+        // that separate States can be evaluated concurrently.
+        if (!_cacheIndex.isValid()) {
+            OPENSIM_THROW(Exception, "Cannot get the value of Channel '" +
+                    getPathName() + "': its Component has no underlying "
+                    "System. You must call initSystem() on the top-level "
+                    "Component (i.e. Model) first.");
+        }
+        if (state.isCacheValueRealized(_subsystemIndex, _cacheIndex)) {
+            return SimTK::Value<T>::downcast(
+                    state.getCacheEntry(_subsystemIndex, _cacheIndex)).get();
+        }
+        T& result = SimTK::Value<T>::updDowncast(
+                state.updCacheEntry(_subsystemIndex, _cacheIndex)).upd();
+        _output->_outputFcn(_output->_owner.get(), state, _channelName, result);
+        if (state.getSystemStage() >= _output->getMemoizationStage())
+            state.markCacheValueRealized(_subsystemIndex, _cacheIndex);
+        return result;
     }
     const Output<T>& getOutput() const { return _output.getRef(); }
     const std::string& getChannelName() const override {
@@ -358,14 +405,17 @@ public:
         return getOutput().getOwner().getAbsolutePathString() + "|" + getName();
     }
 private:
-    mutable T _result;
     SimTK::ReferencePtr<const Output<T>> _output;
     std::string _channelName;
+    // Location of the memoized value in the State; set when the Output's
+    // Component realizes Topology.
+    mutable SimTK::SubsystemIndex _subsystemIndex;
+    mutable SimTK::CacheEntryIndex _cacheIndex;
     
 #ifndef SWIG // These declarations cause a warning in SWIG.
-    // To allow Output<T> to set the _output pointer upon copy.
-    friend Output<T>::Output(const Output&);
-    friend Output<T>& Output<T>::operator=(const Output&);
+    // To allow Output<T> to set the _output pointer upon copy, and the
+    // cache entry upon realizing Topology.
+    friend class Output<T>;
 #endif
 };
 
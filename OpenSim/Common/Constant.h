@@ -89,6 +89,15 @@ public:
     {
         return _value;
     }
+    double calcValue(double xUnused) const override
+    {
+        return _value;
+    }
+    using Function::calcDerivative;
+    double calcDerivative(double xUnused, int order) const override
+    {
+        return order == 0 ? _value : 0.0;
+    }
     const double getValue() const { return _value; }
     SimTK::Function* createSimTKFunction() const override;
 //=============================================================================
@@ -32,6 +32,7 @@ in-memory container for data access and manipulation.                         */
 #include "FileAdapter.h"
 #include "SimTKcommon/internal/BigMatrix.h"
 
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 
@@ -72,12 +73,42 @@ public:
     typedef SimTK::MatrixView_<ETY>    MatrixView;
 
     DataTable_()                             = default;
-    DataTable_(const DataTable_&)            = default;
-    DataTable_(DataTable_&&)                 = default;
-    DataTable_& operator=(const DataTable_&) = default;
-    DataTable_& operator=(DataTable_&&)      = default;
     ~DataTable_()                            = default;
 
+    // The copy and move operations point the view of the matrix returned by
+    // getMatrix() and updMatrix() at this table's own data.
+    DataTable_(const DataTable_& that) :
+        AbstractDataTable(that),
+        _indData(that._indData),
+        _depData(that._depData) {
+        updateMatrixView();
+    }
+
+    DataTable_(DataTable_&& that) :
+        AbstractDataTable(std::move(that)),
+        _indData(std::move(that._indData)),
+        _depData(std::move(that._depData)) {
+        updateMatrixView();
+        that.updateMatrixView();
+    }
+
+    DataTable_& operator=(const DataTable_& that) {
+        AbstractDataTable::operator=(that);
+        _indData = that._indData;
+        _depData = that._depData;
+        updateMatrixView();
+        return *this;
+    }
+
+    DataTable_& operator=(DataTable_&& that) {
+        AbstractDataTable::operator=(std::move(that));
+        _indData = std::move(that._indData);
+        _depData = std::move(that._depData);
+        updateMatrixView();
+        that.updateMatrixView();
+        return *this;
+    }
+
     std::shared_ptr<AbstractDataTable> clone() const override {
         return std::shared_ptr<AbstractDataTable>{new DataTable_{*this}};
     }
@@ -222,6 +253,7 @@ public:
         // This calls validateDependentsMetadata, so no need for explicit call.
         setColumnLabels(thisLabels);
 
+        reserveRows(that.getNumRows());
         for(unsigned r = 0; r < that.getNumRows(); ++r) {
             const auto& thatInd = that.getIndependentColumn().at(r);
             const auto& thatRow = that.getRowAtIndex(r);
@@ -375,6 +407,7 @@ public:
         setColumnLabels(thisLabels);
 
         // Form rows for this table from that table.
+        reserveRows(that.getNumRows());
         for(unsigned r = 0; r < that.getNumRows(); ++r) {
             const auto& thatInd = that.getIndependentColumn().at(r);
             auto thatRow = that.getRowAtIndex(r).getAsRowVector();
@@ -639,7 +672,10 @@ public:
         appendRow(indRow, depRow.getAsRowVectorView());
     }
 
-    /** Append row to the DataTable_.                                         
+    /** Append row to the DataTable_. Appending is amortized constant time:
+    the underlying matrix keeps spare rows, and its number of rows is doubled
+    when they run out. Use reserveRows() if the number of rows is known in
+    advance.
 
     \throws IncorrectNumColumns If the row added is invalid. Validity of the 
     row added is decided by the derived class.                                */
@@ -655,16 +691,50 @@ public:
                              labels.size(),
                              static_cast<size_t>(depRow.ncol()));
         }
+        OPENSIM_THROW_IF(!_indData.empty() &&
+                         depRow.ncol() != _depData.ncol(),
+                         IncorrectNumColumns,
+                         static_cast<size_t>(_depData.ncol()),
+                         static_cast<size_t>(depRow.ncol()));
+
+        // Grow geometrically, or to the capacity reserved with reserveRows().
+        const int row = static_cast<int>(_indData.size());
+        if(row >= _depData.nrow() || _depData.ncol() != depRow.ncol()) {
+            const int capacity = std::max({2 * row, 1,
+                static_cast<int>(_indData.capacity())});
+            if(row == 0)
+                _depData.resize(capacity, depRow.ncol());
+            else
+                _depData.resizeKeep(capacity, _depData.ncol());
+        }
+        _depData.updRow(row) = depRow;
 
         _indData.push_back(indRow);
+        updateMatrixView();
+    }
+
+    /** Reserve memory for a total of numRows rows, so that appending rows
+    until the table has numRows rows does not reallocate. For a table without
+    rows, the memory is allocated when the first row is appended. This does
+    not change the number of rows.                                            */
+    void reserveRows(size_t numRows) {
+        _indData.reserve(numRows);
+
+        if(!_indData.empty() && static_cast<int>(numRows) > _depData.nrow()) {
+            _depData.resizeKeep(static_cast<int>(numRows), _depData.ncol());
+            updateMatrixView();
+        }
+    }
 
-        if(_depData.nrow() == 0) {
-            _depData.resize(1, depRow.size());
+    /** Release any memory reserved for rows beyond the current number of
+    rows (see reserveRows() and appendRow()).                                 */
+    void shrinkToFit() {
+        if(_depData.nrow() > static_cast<int>(_indData.size())) {
+            _depData.resizeKeep(static_cast<int>(_indData.size()),
+                                _depData.ncol());
+            updateMatrixView();
         }
-        else 
-            _depData.resizeKeep(_depData.nrow() + 1, _depData.ncol());
-            
-        _depData.updRow(_depData.nrow() - 1) = depRow;
+        _indData.shrink_to_fit();
     }
 
     /** Get row at index.                                                     
@@ -779,12 +849,12 @@ public:
                          RowIndexOutOfRange, 
                          index, 0, static_cast<unsigned>(_indData.size() - 1));
 
-        if(index < getNumRows() - 1)
-            for(size_t r = index; r < getNumRows() - 1; ++r)
-                _depData.updRow((int)index) = _depData.row((int)(index + 1));
+        // Shift the rows that follow up by one; the last row becomes a spare.
+        for(size_t r = index; r + 1 < getNumRows(); ++r)
+            _depData.updRow((int)r) = _depData.row((int)(r + 1));
         
-        _depData.resizeKeep(_depData.nrow() - 1, _depData.ncol());
         _indData.erase(_indData.begin() + index);
+        updateMatrixView();
     }
 
     /** Remove row corresponding to the given entry in the independent column.
@@ -938,7 +1008,9 @@ public:
                          static_cast<size_t>(depCol.nrow()));
         
         _depData.resizeKeep(_depData.nrow(), _depData.ncol() + 1);
-        _depData.updCol(_depData.ncol() - 1) = depCol;
+        for(int r = 0; r < depCol.nrow(); ++r)
+            _depData.updElt(r, _depData.ncol() - 1) = depCol[r];
+        updateMatrixView();
         appendColumnLabel(columnLabel);
     }
 
@@ -953,7 +1025,8 @@ public:
                          ColumnIndexOutOfRange, index, 0,
                          static_cast<size_t>(_depData.ncol() - 1));
 
-        return _depData.col(static_cast<int>(index));
+        return _depData.col(static_cast<int>(index))
+                       .block(0, static_cast<int>(getNumRows()));
     }
 
     /** Get dependent Column which has the given column label.                
@@ -961,7 +1034,8 @@ public:
     \throws KeyNotFound If columnLabel is not found to be label of any existing
                         column.                                               */
     VectorView getDependentColumn(const std::string& columnLabel) const {
-        return _depData.col(static_cast<int>(getColumnIndex(columnLabel)));
+        return _depData.col(static_cast<int>(getColumnIndex(columnLabel)))
+                       .block(0, static_cast<int>(getNumRows()));
     }
 
     /** Update dependent column at index.
@@ -975,7 +1049,8 @@ public:
                          ColumnIndexOutOfRange, index, 0,
                          static_cast<size_t>(_depData.ncol() - 1));
 
-        return _depData.updCol(static_cast<int>(index));
+        return _depData.updCol(static_cast<int>(index))
+                       .updBlock(0, static_cast<int>(getNumRows()));
     }
 
     /** Update dependent Column which has the given column label.
@@ -983,7 +1058,8 @@ public:
     \throws KeyNotFound If columnLabel is not found to be label of any existing
                         column.                                               */
     VectorView updDependentColumn(const std::string& columnLabel) {
-        return _depData.updCol(static_cast<int>(getColumnIndex(columnLabel)));
+        return _depData.updCol(static_cast<int>(getColumnIndex(columnLabel)))
+                       .updBlock(0, static_cast<int>(getNumRows()));
     }
 
     /** %Set value of the independent column at index.
@@ -1010,9 +1086,10 @@ public:
     /// column.
     /// @{
 
-    /** Get a read-only view to the underlying matrix.                        */
+    /** Get a read-only view to the underlying matrix. The view remains valid
+    until rows or columns are added to or removed from the table.             */
     const MatrixView& getMatrix() const {
-        return _depData.getAsMatrixView();
+        return *_depView;
     }
 
     /** Get a read-only view of a block of the underlying matrix.             
@@ -1034,11 +1111,11 @@ public:
         OPENSIM_THROW_IF(isRowIndexOutOfRange(rowStart),
                          RowIndexOutOfRange,
                          rowStart, 0, 
-                         static_cast<unsigned>(_depData.nrow() - 1));
+                         static_cast<unsigned>(_indData.size() - 1));
         OPENSIM_THROW_IF(isRowIndexOutOfRange(rowStart + numRows - 1),
                          RowIndexOutOfRange,
                          rowStart + numRows - 1, 0, 
-                         static_cast<unsigned>(_depData.nrow() - 1));
+                         static_cast<unsigned>(_indData.size() - 1));
         OPENSIM_THROW_IF(isColumnIndexOutOfRange(columnStart),
                          ColumnIndexOutOfRange,
                          columnStart, 0, 
@@ -1054,9 +1131,10 @@ public:
                               static_cast<int>(numColumns));
     }
 
-    /** Get a writable view to the underlying matrix.                         */
+    /** Get a writable view to the underlying matrix. The view remains valid
+    until rows or columns are added to or removed from the table.             */
     MatrixView& updMatrix() {
-        return _depData.updAsMatrixView();
+        return *_depView;
     }
 
     /** Get a writable view of a block of the underlying matrix.
@@ -1078,11 +1156,11 @@ public:
         OPENSIM_THROW_IF(isRowIndexOutOfRange(rowStart),
                          RowIndexOutOfRange,
                          rowStart, 0, 
-                         static_cast<unsigned>(_depData.nrow() - 1));
+                         static_cast<unsigned>(_indData.size() - 1));
         OPENSIM_THROW_IF(isRowIndexOutOfRange(rowStart + numRows - 1),
                          RowIndexOutOfRange,
                          rowStart + numRows - 1, 0, 
-                         static_cast<unsigned>(_depData.nrow() - 1));
+                         static_cast<unsigned>(_indData.size() - 1));
         OPENSIM_THROW_IF(isColumnIndexOutOfRange(columnStart),
                          ColumnIndexOutOfRange,
                          columnStart, 0, 
@@ -1188,6 +1266,7 @@ protected:
         setColumnLabels(labels);
         _indData = indVec;
         _depData = depData;
+        updateMatrixView();
     }
 
     /** Construct a table with only the independent column and 0
@@ -1197,6 +1276,7 @@ protected:
         setColumnLabels({});
         _indData = indVec;
         _depData.resize((int)indVec.size(), 0);
+        updateMatrixView();
     }
 
     // Implement toString.
@@ -1452,12 +1532,12 @@ protected:
 
     /** Get number of rows.                                                   */
     size_t implementGetNumRows() const override {
-        return _depData.nrow();
+        return _indData.size();
     }
 
     /** Get number of columns.                                                */
     size_t implementGetNumColumns() const override {
-        return _depData.ncol();
+        return static_cast<size_t>(_depData.ncol());
     }
 
     /** Validate metadata for independent column.                             
@@ -1529,8 +1609,22 @@ protected:
         return M * N;
     }
 
+    /** Point the view returned by getMatrix() and updMatrix() at the rows of
+    the underlying matrix that are in use. Call this whenever the number of
+    rows or columns changes or the matrix is reallocated.                     */
+    void updateMatrixView() {
+        _depView.reset(new MatrixView(_depData.updBlock(0, 0,
+                                      static_cast<int>(_indData.size()),
+                                      _depData.ncol())));
+    }
+
     std::vector<ETX>    _indData;
+    // Dependent data. Only the first _indData.size() rows are in use; the
+    // rest are capacity for appendRow() and reserveRows().
     SimTK::Matrix_<ETY> _depData;
+    // View of the rows of _depData that are in use.
+    std::unique_ptr<MatrixView> _depView{
+        new MatrixView(_depData.updAsMatrixView())};
 };  // DataTable_
 
 
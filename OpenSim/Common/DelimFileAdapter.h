@@ -122,10 +122,12 @@ protected:
     void extendWrite(const InputTables& tables,
                      const std::string& filename) const override;
 
-    /** Read elements of type T (template parameter) from a sequence of 
-    tokens.                                                                   */
-    inline SimTK::RowVector_<T> 
-    readElems(const std::vector<std::string>& tokens) const;
+    /** Read an element of type T (template parameter) from a token referring
+    to a buffer. `comps` is scratch space used to split the token into the
+    components of the element.                                                */
+    inline void readElem(const TokenRange& token,
+                         std::vector<TokenRange>& comps,
+                         T& elem) const;
 
     /** Write an element of type T (template parameter) to stream with the
     specified precision.                                                      */
@@ -142,23 +144,23 @@ private:
     template<int M>
     static inline std::string dataTypeName_impl(SimTK::Vec<M>);
 
-    /** Following overloads implement readElems().                            */
-    inline SimTK::RowVector_<double>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   double) const;
-    inline SimTK::RowVector_<SimTK::UnitVec3>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::UnitVec3) const;
-    inline SimTK::RowVector_<SimTK::Quaternion>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::Quaternion) const;
-    inline SimTK::RowVector_<SimTK::SpatialVec>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::SpatialVec) const;
+    /** Following overloads implement readElem().                             */
+    inline void readElem_impl(const TokenRange& token,
+                              std::vector<TokenRange>& comps,
+                              double& elem) const;
+    inline void readElem_impl(const TokenRange& token,
+                              std::vector<TokenRange>& comps,
+                              SimTK::UnitVec3& elem) const;
+    inline void readElem_impl(const TokenRange& token,
+                              std::vector<TokenRange>& comps,
+                              SimTK::Quaternion& elem) const;
+    inline void readElem_impl(const TokenRange& token,
+                              std::vector<TokenRange>& comps,
+                              SimTK::SpatialVec& elem) const;
     template<int M>
-    inline SimTK::RowVector_<SimTK::Vec<M>>
-    readElems_impl(const std::vector<std::string>& tokens,
-                   SimTK::Vec<M>) const;
+    inline void readElem_impl(const TokenRange& token,
+                              std::vector<TokenRange>& comps,
+                              SimTK::Vec<M>& elem) const;
 
     /** Following overloads implement writeElem().                            */
     inline void writeElem_impl(std::ostream& stream,
@@ -302,14 +304,14 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
     OPENSIM_THROW_IF(fileName.empty(),
                      EmptyFileName);
 
-    std::ifstream in_stream{fileName};
-    OPENSIM_THROW_IF(!in_stream.good(),
-                     FileDoesNotExist,
-                     fileName);
-    
-    OPENSIM_THROW_IF(in_stream.peek() == std::ifstream::traits_type::eof(),
+    // Read the whole file at once and parse it in place. This avoids
+    // allocating a string for every line and token of the file.
+    const std::string contents = readFileContents(fileName);
+    OPENSIM_THROW_IF(contents.empty(),
                      FileIsEmpty,
                      fileName);
+    const char* pos = contents.data();
+    const char* const end = contents.data() + contents.size();
 
     auto table = std::make_shared<TimeSeriesTable_<T>>();
 
@@ -318,15 +320,11 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
     std::regex endheader{R"([ \t]*)" + _endHeaderString + R"([ \t]*)"};
     std::regex keyvalue{R"((.*)=(.*))"};
     std::string header{};
-    std::string line{};
-    while(std::getline(in_stream, line)) {
+    TokenRange line_range{};
+    while(getNextLine(pos, end, line_range)) {
         ++line_num;
 
-        // We might be parsing a file with CRLF (\r\n) line endings on a
-        // platform that uses only LF (\n) line endings, in which case the \r
-        // is part of `line` and we must remove it manually.
-        if (!line.empty() && line.back() == '\r') 
-            line.pop_back();
+        const std::string line{line_range.first, line_range.second};
 
         if(std::regex_match(line, endheader))
             break;
@@ -363,17 +361,20 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
     }
     table->updTableMetaData().setValueForKey("header", header);
 
-    // Callable to get the next line in form of vector of tokens.
-    auto nextLine = [&] {
-        return getNextLine(in_stream, _delimitersRead);
-    };
+    // Tokens of the current line. Reused for every line.
+    std::vector<TokenRange> tokens{};
+    // Components of the current element. Reused for every element.
+    std::vector<TokenRange> comps{};
 
     // Read the line containing column labels and fill up the column labels
     // container.
-    auto column_labels = nextLine();
-    OPENSIM_THROW_IF(column_labels.size() == 0, Exception,
+    getNextLine(pos, end, _delimitersRead, tokens);
+    OPENSIM_THROW_IF(tokens.size() == 0, Exception,
                      "No column labels detected in file '" + fileName + "'.");
     ++line_num;
+    std::vector<std::string> column_labels{};
+    for(const auto& token : tokens)
+        column_labels.emplace_back(token.first, token.second);
     // Column 0 is the time column. Check and get rid of it. The data in this
     // column is maintained separately from rest of the data.
     OPENSIM_THROW_IF(column_labels[0] != _timeColumnLabel,
@@ -390,29 +391,30 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
     dep_metadata.setValueArrayForKey("labels", value_array);
     table->setDependentsMetaData(dep_metadata);
 
+    // Every remaining line holds at most one row; reserve room for all of them
+    // so that appending rows does not reallocate.
+    table->reserveRows(countLines(pos, end));
+
     // Read the rows one at a time and fill up the time column container and
     // the data container.
-    auto row = nextLine();
-    while(!row.empty()) {
+    SimTK::RowVector_<T> row_vector{static_cast<int>(column_labels.size())};
+    while(getNextLine(pos, end, _delimitersRead, tokens)) {
         ++line_num;
 
-        // Time is column 0.
-        double time = std::stod(row.front());
-        row.erase(row.begin());
-
-        auto row_vector = readElems(row);
-
-        OPENSIM_THROW_IF(row_vector.size() != column_labels.size(),
+        OPENSIM_THROW_IF(tokens.size() - 1 != column_labels.size(),
                          RowLengthMismatch,
                          fileName,
                          line_num,
                          column_labels.size(),
-                         static_cast<size_t>(row_vector.size()));
+                         tokens.size() - 1);
+
+        // Time is column 0.
+        double time = parseDouble(tokens[0]);
 
-        // Column 1 is time.
-        table->appendRow(time, std::move(row_vector));
+        for(size_t i = 1; i < tokens.size(); ++i)
+            readElem(tokens[i], comps, row_vector[static_cast<int>(i - 1)]);
 
-        row = nextLine();
+        table->appendRow(time, row_vector);
     }
 
     OutputTables output_tables{};
@@ -422,99 +424,81 @@ DelimFileAdapter<T>::extendRead(const std::string& fileName) const {
 }
 
 template<typename T>
-SimTK::RowVector_<T>
-DelimFileAdapter<T>::readElems(const std::vector<std::string>& tokens) const {
-    return readElems_impl(tokens, T{});
+void
+DelimFileAdapter<T>::readElem(const TokenRange& token,
+                              std::vector<TokenRange>& comps,
+                              T& elem) const {
+    readElem_impl(token, comps, elem);
 }
 
 template<typename T>
-SimTK::RowVector_<double>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    double) const {
-    SimTK::RowVector_<double> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i)
-        elems[static_cast<int>(i)] = std::stod(tokens[i]);
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TokenRange& token,
+                                   std::vector<TokenRange>&,
+                                   double& elem) const {
+    elem = parseDouble(token);
 }
 
 template<typename T>
-SimTK::RowVector_<SimTK::UnitVec3>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::UnitVec3) const {
-    SimTK::RowVector_<SimTK::UnitVec3> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != 3, 
-                         IncorrectNumTokens,
-                         "Expected 3x (multiple of 3) number of tokens.");
-        elems[i] = SimTK::UnitVec3{std::stod(comps[0]),
-                                   std::stod(comps[1]),
-                                   std::stod(comps[2])};
-    }
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TokenRange& token,
+                                   std::vector<TokenRange>& comps,
+                                   SimTK::UnitVec3& elem) const {
+    tokenize(token, _compDelimRead, comps);
+    OPENSIM_THROW_IF(comps.size() != 3, 
+                     IncorrectNumTokens,
+                     "Expected 3x (multiple of 3) number of tokens.");
+    elem = SimTK::UnitVec3{parseDouble(comps[0]),
+                           parseDouble(comps[1]),
+                           parseDouble(comps[2])};
 }
 
 template<typename T>
-SimTK::RowVector_<SimTK::Quaternion>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::Quaternion) const {
-    SimTK::RowVector_<SimTK::Quaternion> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != 4, 
-                         IncorrectNumTokens,
-                         "Expected 4x (multiple of 4) number of tokens.");
-        elems[i] = SimTK::Quaternion{std::stod(comps[0]),
-                                     std::stod(comps[1]),
-                                     std::stod(comps[2]),
-                                     std::stod(comps[3])};
-    }
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TokenRange& token,
+                                   std::vector<TokenRange>& comps,
+                                   SimTK::Quaternion& elem) const {
+    tokenize(token, _compDelimRead, comps);
+    OPENSIM_THROW_IF(comps.size() != 4, 
+                     IncorrectNumTokens,
+                     "Expected 4x (multiple of 4) number of tokens.");
+    elem = SimTK::Quaternion{parseDouble(comps[0]),
+                             parseDouble(comps[1]),
+                             parseDouble(comps[2]),
+                             parseDouble(comps[3])};
 }
 
 template<typename T>
-SimTK::RowVector_<SimTK::SpatialVec>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::SpatialVec) const {
-    SimTK::RowVector_<SimTK::SpatialVec> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != 6, 
-                         IncorrectNumTokens,
-                         "Expected 6x (multiple of 6) number of tokens.");
-        elems[i] = SimTK::SpatialVec{{std::stod(comps[0]),
-                                      std::stod(comps[1]),
-                                      std::stod(comps[2])},
-                                     {std::stod(comps[3]),
-                                      std::stod(comps[4]),
-                                      std::stod(comps[5])}};
-    }
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TokenRange& token,
+                                   std::vector<TokenRange>& comps,
+                                   SimTK::SpatialVec& elem) const {
+    tokenize(token, _compDelimRead, comps);
+    OPENSIM_THROW_IF(comps.size() != 6, 
+                     IncorrectNumTokens,
+                     "Expected 6x (multiple of 6) number of tokens.");
+    elem = SimTK::SpatialVec{{parseDouble(comps[0]),
+                              parseDouble(comps[1]),
+                              parseDouble(comps[2])},
+                             {parseDouble(comps[3]),
+                              parseDouble(comps[4]),
+                              parseDouble(comps[5])}};
 }
 
 template<typename T>
 template<int M>
-SimTK::RowVector_<SimTK::Vec<M>>
-DelimFileAdapter<T>::readElems_impl(const std::vector<std::string>& tokens,
-                                    SimTK::Vec<M>) const {
-    SimTK::RowVector_<SimTK::Vec<M>> elems{static_cast<int>(tokens.size())};
-    for(auto i = 0u; i < tokens.size(); ++i) {
-        auto comps = tokenize(tokens[i], _compDelimRead);
-        OPENSIM_THROW_IF(comps.size() != M, 
-                         IncorrectNumTokens,
-                         "Expected " + std::to_string(M) +
-                         "x (multiple of " + std::to_string(M) +
-                         ") number of tokens.");
-        for(int j = 0; j < M; ++j) {
-            elems[i][j] = std::stod(comps[j]);
-        }
-    }
-
-    return elems;
+void
+DelimFileAdapter<T>::readElem_impl(const TokenRange& token,
+                                   std::vector<TokenRange>& comps,
+                                   SimTK::Vec<M>& elem) const {
+    tokenize(token, _compDelimRead, comps);
+    OPENSIM_THROW_IF(comps.size() != M, 
+                     IncorrectNumTokens,
+                     "Expected " + std::to_string(M) +
+                     "x (multiple of " + std::to_string(M) +
+                     ") number of tokens.");
+    for(int j = 0; j < M; ++j)
+        elem[j] = parseDouble(comps[j]);
 }
   
 template<typename T>
@@ -1,5 +1,9 @@
 #include "FileAdapter.h"
 
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
 namespace OpenSim {
 
 std::shared_ptr<DataAdapter>
@@ -93,4 +97,174 @@ FileAdapter::getNextLine(std::istream& stream,
     return {};
 }
 
+std::string
+FileAdapter::readFileContents(const std::string& fileName) {
+    std::ifstream in_stream{fileName, std::ios::in | std::ios::binary};
+    OPENSIM_THROW_IF(!in_stream.good(),
+                     FileDoesNotExist,
+                     fileName);
+
+    in_stream.seekg(0, std::ios::end);
+    const auto size = in_stream.tellg();
+    in_stream.seekg(0, std::ios::beg);
+
+    std::string contents{};
+    if(size > 0) {
+        contents.resize(static_cast<size_t>(size));
+        in_stream.read(&contents[0], size);
+        contents.resize(static_cast<size_t>(in_stream.gcount()));
+    }
+    return contents;
+}
+
+bool
+FileAdapter::getNextLine(const char*& pos, const char* end,
+                         TokenRange& line) {
+    if(pos >= end)
+        return false;
+
+    const char* eol = static_cast<const char*>(
+            std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+    if(eol == nullptr)
+        eol = end;
+
+    line.first = pos;
+    line.second = eol;
+    // Get rid of the extra \r if parsing a file with CRLF line endings.
+    if(line.second != line.first && *(line.second - 1) == '\r')
+        --line.second;
+
+    pos = (eol == end) ? end : eol + 1;
+    return true;
+}
+
+void
+FileAdapter::tokenize(const TokenRange& str, const std::string& delims,
+                      std::vector<TokenRange>& tokens) {
+    tokens.clear();
+
+    const char* token_start{str.first};
+    bool is_token{false};
+    for(const char* c = str.first; c != str.second; ++c) {
+        if(delims.find(*c) != std::string::npos) {
+            if(is_token) {
+                tokens.emplace_back(token_start, c);
+                is_token = false;
+            }
+        } else if(!is_token) {
+            token_start = c;
+            is_token = true;
+        }
+    }
+    if(is_token)
+        tokens.emplace_back(token_start, str.second);
+}
+
+bool
+FileAdapter::getNextLine(const char*& pos, const char* end,
+                         const std::string& delims,
+                         std::vector<TokenRange>& tokens) {
+    TokenRange line{};
+    while(getNextLine(pos, end, line)) {
+        tokenize(line, delims, tokens);
+        if(!tokens.empty())
+            return true;
+    }
+    tokens.clear();
+    return false;
+}
+
+size_t
+FileAdapter::countLines(const char* pos, const char* end) {
+    size_t count{0};
+    while(pos < end) {
+        ++count;
+        const char* eol = static_cast<const char*>(
+                std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+        if(eol == nullptr)
+            break;
+        pos = eol + 1;
+    }
+    return count;
+}
+
+double
+FileAdapter::parseDouble(const TokenRange& token) {
+    // Exact powers of ten representable by a double.
+    static const double powersOfTen[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    static const std::uint64_t maxExactInteger = std::uint64_t{1} << 53;
+
+    auto fallback = [&token] {
+        return std::stod(std::string{token.first, token.second});
+    };
+
+    const char* c = token.first;
+    const char* end = token.second;
+
+    bool negative{false};
+    if(c != end && (*c == '-' || *c == '+'))
+        negative = (*c++ == '-');
+
+    // Accumulate all digits of the significand, ignoring the decimal point
+    // but keeping track of its position in 'exponent'.
+    std::uint64_t significand{0};
+    int numSignificantDigits{0};
+    int numDigits{0};
+    int exponent{0};
+    bool seenPoint{false};
+    for(; c != end; ++c) {
+        if(*c >= '0' && *c <= '9') {
+            ++numDigits;
+            if(significand != 0 || *c != '0')
+                ++numSignificantDigits;
+            if(numSignificantDigits > 19)
+                return fallback();
+            significand = 10 * significand + static_cast<unsigned>(*c - '0');
+            if(seenPoint)
+                --exponent;
+        } else if(*c == '.' && !seenPoint) {
+            seenPoint = true;
+        } else
+            break;
+    }
+    if(numDigits == 0)
+        return fallback();
+
+    if(c != end && (*c == 'e' || *c == 'E')) {
+        ++c;
+        bool negativeExponent{false};
+        if(c != end && (*c == '-' || *c == '+'))
+            negativeExponent = (*c++ == '-');
+        if(c == end)
+            return fallback();
+        int explicitExponent{0};
+        for(; c != end && *c >= '0' && *c <= '9'; ++c) {
+            explicitExponent = 10 * explicitExponent + (*c - '0');
+            if(explicitExponent > 1000)
+                return fallback();
+        }
+        exponent += negativeExponent ? -explicitExponent : explicitExponent;
+    }
+
+    // Trailing characters are left to std::stod() to deal with.
+    if(c != end)
+        return fallback();
+
+    // Both the significand and the power of ten are exact doubles, so a
+    // single multiplication/division is correctly rounded and matches the
+    // result of std::stod() (Clinger's fast path).
+    if(significand > maxExactInteger || exponent < -22 || exponent > 22)
+        return fallback();
+
+    double value = static_cast<double>(significand);
+    if(exponent < 0)
+        value /= powersOfTen[-exponent];
+    else
+        value *= powersOfTen[exponent];
+
+    return negative ? -value : value;
+}
+
 } // namespace OpenSim
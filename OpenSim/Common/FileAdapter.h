@@ -28,6 +28,7 @@
 */
 #include "DataAdapter.h"
 
+#include <utility>
 #include <vector>
 
 namespace OpenSim {
@@ -213,6 +214,50 @@ protected:
     the given delimiters.                                                     */
     std::vector<std::string> getNextLine(std::istream& stream,
                                          const std::string& delims) const;
+
+    /** A token referring to the range [first, second) of characters of a
+    buffer, typically one returned by readFileContents().                     */
+    typedef std::pair<const char*, const char*> TokenRange;
+
+    /** Read the entire contents of a file into memory with a single read, so
+    that it can be parsed in place with getNextLine(const char*&, ...)
+    instead of line by line through a stream.
+
+    \throws FileDoesNotExist If the file cannot be opened.                    */
+    static std::string readFileContents(const std::string& fileName);
+
+    /** Get the next line of a buffer. The line begins at `pos`, which is
+    advanced past the end of the line. Trailing carriage returns (CRLF line
+    endings) are removed. Returns false if there are no more lines.           */
+    static bool getNextLine(const char*& pos, const char* end,
+                            TokenRange& line);
+
+    /** Get the next non-empty line of a buffer and tokenize/split it in place
+    using the given delimiters (see tokenize()). No strings are allocated;
+    the tokens refer to the characters of the buffer. The line begins at
+    `pos`, which is advanced past the end of the line. Returns false (and no
+    tokens) if there are no more non-empty lines.                             */
+    static bool getNextLine(const char*& pos, const char* end,
+                            const std::string& delims,
+                            std::vector<TokenRange>& tokens);
+
+    /** Tokenize/split a range of characters in place using the given
+    delimiters. `tokens` is cleared first.                                    */
+    static void tokenize(const TokenRange& str, const std::string& delims,
+                         std::vector<TokenRange>& tokens);
+
+    /** Number of lines in the buffer from `pos` until `end`. This is an upper
+    bound on the number of rows of data left to be read.                      */
+    static size_t countLines(const char* pos, const char* end);
+
+    /** Convert a token to a double. The result is identical to that of
+    std::stod() on the same characters, but the common case -- a decimal
+    number with at most 19 significant digits and a moderate exponent -- is
+    converted without allocating or consulting the locale. Anything else
+    (e.g., "NaN", "inf" or very long numbers) is handed to std::stod().
+
+    \throws std::invalid_argument If the token is not a number.               */
+    static double parseDouble(const TokenRange& token);
 };
 
 } // OpenSim namespace
@@ -173,6 +173,25 @@ double Function::calcDerivative(const std::vector<int>& derivComponents, const V
     return _function->calcDerivative(derivComponents, x);
 }
 
+double Function::calcValue(double x) const
+{
+    return calcValue(Vector(1, x));
+}
+
+double Function::calcDerivative(double x, int order) const
+{
+    if (order == 0)
+        return calcValue(x);
+    return calcDerivative(std::vector<int>(order, 0), Vector(1, x));
+}
+
+void Function::calcValues(const double* x, double* values, int n,
+                          int order) const
+{
+    for (int i = 0; i < n; ++i)
+        values[i] = calcDerivative(x[i], order);
+}
+
 int Function::getArgumentSize() const
 {
     if (_function == NULL)
@@ -114,6 +114,26 @@ public:
      * @param x                the Vector of input arguments.  Its size must equal the value returned by getArgumentSize().
      */
     virtual double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const;
+    /**
+     * Calculate the value of a function of one argument at x. This avoids
+     * constructing a SimTK::Vector for each evaluation; the functions in this
+     * library of one argument override it to evaluate the function directly.
+     */
+    virtual double calcValue(double x) const;
+    /**
+     * Calculate the derivative of the given order of a function of one
+     * argument at x. An order of 0 gives the value of the function.
+     */
+    virtual double calcDerivative(double x, int order) const;
+    /**
+     * Calculate the value (order 0) or the derivative of the given order of a
+     * function of one argument at each of the n points in x, and store the
+     * results in values. Overriding this allows a function to reuse work
+     * from one point to the next, e.g., the interval found for a point whose
+     * abscissa is close to that of the previous point.
+     */
+    virtual void calcValues(const double* x, double* values, int n,
+                            int order = 0) const;
     /**
      * Get the number of components expected in the input vector.
      */
@@ -44,14 +44,22 @@ FunctionAdapter::FunctionAdapter(const OpenSim::Function& aFunction) : _function
 //=============================================================================
 // SimTK::Function METHODS
 //=============================================================================
+// Functions of one argument are evaluated through the scalar methods of
+// OpenSim::Function, which most of them implement without a Vector.
 double FunctionAdapter::calcValue(const Vector& x) const {
+    if (x.size() == 1)
+        return _function.calcValue(x[0]);
     return _function.calcValue(x);
 }
 double FunctionAdapter::calcDerivative(const std::vector<int>& derivComponents, const Vector& x) const {
+    if (x.size() == 1)
+        return _function.calcDerivative(x[0], (int)derivComponents.size());
     return _function.calcDerivative(derivComponents, x);
 }
 
 double FunctionAdapter::calcDerivative(const SimTK::Array_<int>& derivComponents, const SimTK::Vector& x) const{
+    if (x.size() == 1)
+        return _function.calcDerivative(x[0], (int)derivComponents.size());
     std::vector<int> dcs(derivComponents.begin(), derivComponents.end());
     return _function.calcDerivative(dcs, x);
 }
@@ -110,15 +110,34 @@ evaluate(int aIndex,int aDerivOrder,double aX) const
 {
     Function& func = get(aIndex);
 
-    SimTK::Vector arg = SimTK::Vector(1, aX);
     if (aDerivOrder==0)
-        return (func.calcValue(arg));
+        return (func.calcValue(aX));
 
-    std::vector<int> derivComponents;
-    for(int i=0; i<aDerivOrder; i++)
-        derivComponents.push_back(0);
+    return( func.calcDerivative(aX, aDerivOrder) );
+}
+
+//_____________________________________________________________________________
+/**
+ * Evaluate a function or one of its derivatives at a sequence of values of
+ * the x independent variable. The values are computed by a single call to
+ * Function::calcValues().
+ *
+ * @param aIndex Index of the function to evaluate.
+ * @param aDerivOrder Order of the derivative to evaluate.
+ * @param aX Values of the x independent variable.
+ * @param rValues Values of the function, one for each value in aX.
+ * @see Function
+ */
+void FunctionSet::
+evaluate(int aIndex,int aDerivOrder,const SimTK::Array_<double> &aX,
+         SimTK::Vector &rValues) const
+{
+    const Function& func = get(aIndex);
+    const int n = (int)aX.size();
+    rValues.resize(n);
+    if (n == 0) return;
 
-    return( func.calcDerivative(derivComponents, arg) );
+    func.calcValues(&aX[0], &rValues[0], n, aDerivOrder);
 }
 
 //_____________________________________________________________________________
@@ -144,13 +163,8 @@ evaluate(Array<double> &rValues,int aDerivOrder,double aX) const
     for(i=0;i<size;i++) {
         Function& func = get(i);
         if (aDerivOrder==0)
-            rValues[i] = func.calcValue(SimTK::Vector(1,aX));
-        else {
-            std::vector<int> derivComponents;
-            for(int j=0; j<aDerivOrder; j++)
-                derivComponents.push_back(0);
-            rValues[i] = func.calcDerivative(derivComponents, SimTK::Vector(1,aX));
-
-        }
+            rValues[i] = func.calcValue(aX);
+        else
+            rValues[i] = func.calcDerivative(aX, aDerivOrder);
     }
 }
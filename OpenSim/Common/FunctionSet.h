@@ -75,6 +75,14 @@ public:
     virtual void
         evaluate(Array<double> &rValues,int aDerivOrder,
         double aX=0.0) const;
+#ifndef SWIG
+    /** Evaluate one function, or one of its derivatives, at each of the
+    values in aX (e.g., all the times of a trajectory) in a single pass.
+    rValues is resized to the size of aX. */
+    virtual void
+        evaluate(int aIndex,int aDerivOrder,
+        const SimTK::Array_<double> &aX,SimTK::Vector &rValues) const;
+#endif
 
 //=============================================================================
 };  // END class FunctionSet
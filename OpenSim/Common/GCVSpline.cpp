@@ -600,3 +600,19 @@ SimTK::Function* GCVSpline::createSimTKFunction() const {
     return spline;
 }
 
+double GCVSpline::calcValue(double x) const
+{
+    if (_function == NULL)
+        _function = createSimTKFunction();
+    return static_cast<const SimTK::Spline*>(_function)->calcValue(x);
+}
+
+double GCVSpline::calcDerivative(double x, int order) const
+{
+    if (order == 0)
+        return calcValue(x);
+    if (_function == NULL)
+        _function = createSimTKFunction();
+    return static_cast<const SimTK::Spline*>(_function)->calcDerivative(order, x);
+}
+
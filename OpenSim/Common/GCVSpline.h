@@ -233,6 +233,10 @@ public:
     //--------------------------------------------------------------------------
     // EVALUATION
     //--------------------------------------------------------------------------
+    using Function::calcValue;
+    using Function::calcDerivative;
+    double calcValue(double x) const override;
+    double calcDerivative(double x, int order) const override;
 
 //=============================================================================
 };  // END class GCVSpline
@@ -174,3 +174,15 @@ SimTK::Function* LinearFunction::createSimTKFunction() const
     SimTK::Vector coeffs(_coefficients.getSize(), &_coefficients[0]);
     return new SimTK::Function::Linear(coeffs);
 }
+
+double LinearFunction::calcValue(double x) const
+{
+    return _coefficients[0]*x + _coefficients[1];
+}
+
+double LinearFunction::calcDerivative(double x, int order) const
+{
+    if (order == 0)
+        return calcValue(x);
+    return order == 1 ? _coefficients[0] : 0.0;
+}
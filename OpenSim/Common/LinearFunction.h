@@ -102,6 +102,10 @@ public:
     // EVALUATION
     //--------------------------------------------------------------------------
     SimTK::Function* createSimTKFunction() const override;
+    using Function::calcValue;
+    using Function::calcDerivative;
+    double calcValue(double x) const override;
+    double calcDerivative(double x, int order) const override;
 
 //=============================================================================
 };  // END class LinearFunction
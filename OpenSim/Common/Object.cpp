@@ -36,6 +36,7 @@
 #include "Property_Deprecated.h"
 #include "PropertyTransform.h"
 #include "IO.h"
+#include "ObjectSnapshot.h"
 
 #include <fstream>
 
@@ -103,6 +104,16 @@ Object::Object(const string &aFileName, bool aUpdateFromXMLNode)
         "Object: Cannot not open file " + aFileName +
         ". It may not exist or you do not have permission to read it.");
 
+    // A binary snapshot has no XML to parse; keep an empty document so that
+    // getInputFileName() still reports where this object came from.
+    if (ObjectSnapshot::isSnapshotFile(aFileName)) {
+        _document = new XMLDocument();
+        _document->setFileName(aFileName);
+        if (aUpdateFromXMLNode)
+            ObjectSnapshot::read(*this, aFileName);
+        return;
+    }
+
     _document = new XMLDocument(aFileName);
 
     // GET DOCUMENT ELEMENT
@@ -193,7 +204,9 @@ Object::Object(SimTK::Xml::Element& aNode)
 Object& Object::operator=(const Object& source)
 {
     if (&source != this) {
+        const bool renamed = _name != source._name;
         _name           = source._name;
+        if (renamed) nameChanged();
         _description    = source._description;
         _authors        = source._authors;
         _references     = source._references;
@@ -226,6 +239,7 @@ void Object::setNull()
 
     _document = NULL;
     _inlined = true;
+    _ownerNameIndexFlag = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -283,7 +297,18 @@ operator<(const Object& other) const
 void Object::
 setName(const string &aName)
 {
+    if(_name == aName) return;
     _name = aName;
+    nameChanged();
+}
+//_____________________________________________________________________________
+/**
+ * Called when the name of this object has changed.
+ */
+void Object::
+nameChanged()
+{
+    if(_ownerNameIndexFlag) _ownerNameIndexFlag->invalidate();
 }
 //_____________________________________________________________________________
 /**
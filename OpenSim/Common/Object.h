@@ -511,6 +511,13 @@ public:
     virtual void updateFromXMLNode(SimTK::Xml::Element& objectElement, 
                                    int                  versionNumber);
 
+    /** This is called in place of updateFromXMLNode() when the property
+    values of this object have been read from a binary snapshot (see
+    ObjectSnapshot). The values are already in the latest format; override
+    this only to rebuild data that updateFromXMLNode() derives from them. 
+    The default implementation does nothing. **/
+    virtual void updateFromSnapshot() {}
+
     /** Serialize this object into the XML node that represents it.   
     @param      parent 
         Parent XML node of this object. Sending in a parent node allows an XML 
@@ -532,6 +539,12 @@ public:
     void setInlined(bool aInlined, const std::string &aFileName="");
 
 protected:
+    /** This is called after setName() or assignment has changed the name of
+    this object. The default implementation marks the index of names of the
+    Set that owns this object, if any, as out of date; overrides must call
+    it. **/
+    virtual void nameChanged();
+
     /** When an object is initialized using the current values of its
     properties, it can set a flag indicating that it is up to date. This
     flag is automatically cleared when any property is modified. This allows
@@ -866,6 +879,13 @@ private:
     // to another fresh document, also cached for subsequent printing/writing.
     mutable bool            _inlined;
 
+    #ifndef SWIG
+    // The flag of the index of names of the ArrayPtrs (e.g., Set) that owns
+    // this object, if any; cleared by nameChanged(). It is not copied.
+    template <class T> friend class ArrayPtrs;
+    NameIndexFlag          *_ownerNameIndexFlag;
+    #endif
+
 //==============================================================================
 };  // END of class Object
 
@@ -1367,6 +1387,24 @@ ObjectProperty<T>::setValueAsObject(const Object& obj, int index) {
 
     objects[index] = newObjT;
 }
+
+template <class T> inline int 
+ObjectProperty<T>::adoptAndAppendValueAsObject(Object* obj) {
+    T* objT = dynamic_cast<T*>(obj);
+    if (objT == NULL) 
+        throw OpenSim::Exception
+            ("ObjectProperty<T>::adoptAndAppendValueAsObject(): the supplied "
+            "object " + obj->getName() + " was of type "
+            + obj->getConcreteClassName() + " which can't be stored in this "
+            + objectClassName + " property " + this->getName());
+    if (getNumValues() >= this->getMaxListSize())
+        throw OpenSim::Exception
+            ("ObjectProperty<T>::adoptAndAppendValueAsObject(): property "
+            + this->getName() + " can't hold any more than "
+            + SimTK::String(this->getMaxListSize()) + " values.");
+    this->setValueIsDefault(false);
+    return adoptAndAppendValueVirtual(objT);
+}
 /** @endcond **/
 
 //==============================================================================
@@ -0,0 +1,568 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  ObjectSnapshot.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+// A snapshot file consists of
+//
+//   header: "OSIMSNAP", format version (uint32), OpenSim version (string),
+//           XML document version (int32), source file hash (uint64),
+//           source file name (string)
+//   object: concrete class name (string), name (string), number of
+//           properties (uint32), and for each property its name (string),
+//           whether it has its default value (uint8), the kind of value it
+//           holds (uint8), and its values.
+//
+// Strings and lists are prefixed by their length (uint32). The values of
+// object properties are themselves object records. Numbers are stored in the
+// byte order of the machine that wrote the file.
+
+#include "ObjectSnapshot.h"
+#include "IO.h"
+#include "Object.h"
+#include "PropertyTransform.h"
+#include "XMLDocument.h"
+#include <OpenSim/version.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+using namespace OpenSim;
+
+namespace {
+
+const char Magic[8] = {'O', 'S', 'I', 'M', 'S', 'N', 'A', 'P'};
+const std::uint32_t FormatVersion = 1;
+
+// The kinds of values a property can hold. Deprecated properties are
+// followed by their Property_Deprecated::PropertyType.
+enum class ValueKind : std::uint8_t {
+    Bool = 1, Int, Double, String, Vec3, Vec6, Vector, Transform, Object,
+    Deprecated
+};
+
+struct Header {
+    std::uint32_t formatVersion;
+    std::string openSimVersion;
+    std::int32_t documentVersion;
+    std::uint64_t sourceHash;
+    std::string sourceFileName;
+
+    bool isCompatible() const {
+        return formatVersion == FormatVersion &&
+               openSimVersion == GetVersion() &&
+               documentVersion == XMLDocument::getLatestVersion();
+    }
+};
+
+std::string makeAbsolute(const std::string& fileName) {
+    const bool isAbsolute =
+        (!fileName.empty() && (fileName[0] == '/' || fileName[0] == '\\')) ||
+        (fileName.size() > 1 && fileName[1] == ':');
+    return isAbsolute ? fileName : IO::getCwd() + "/" + fileName;
+}
+
+bool fileExists(const std::string& fileName) {
+    return std::ifstream(fileName).good();
+}
+
+std::string readFile(const std::string& fileName) {
+    std::ifstream in(fileName, std::ios::in | std::ios::binary);
+    OPENSIM_THROW_IF(!in, Exception,
+        "ObjectSnapshot: Cannot open file " + fileName + ".");
+    in.seekg(0, std::ios::end);
+    std::string buffer(static_cast<size_t>(in.tellg()), '\0');
+    in.seekg(0, std::ios::beg);
+    in.read(&buffer[0], buffer.size());
+    return buffer;
+}
+
+//------------------------------------------------------------------------------
+//                                  WRITER
+//------------------------------------------------------------------------------
+class Writer {
+public:
+    const std::string& getBuffer() const { return _buffer; }
+
+    template <class T> void pod(const T& value) {
+        _buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    void size(int n) { pod(static_cast<std::uint32_t>(n)); }
+    void kind(ValueKind k) { pod(static_cast<std::uint8_t>(k)); }
+
+    void value(bool v) { pod(static_cast<std::uint8_t>(v)); }
+    void value(int v) { pod(static_cast<std::int32_t>(v)); }
+    void value(double v) { pod(v); }
+    void value(const std::string& v) {
+        size(static_cast<int>(v.size()));
+        _buffer.append(v);
+    }
+    template <int M> void value(const SimTK::Vec<M>& v) {
+        for (int i = 0; i < M; ++i) pod(v[i]);
+    }
+    void value(const SimTK::Vector& v) {
+        size(v.size());
+        for (int i = 0; i < v.size(); ++i) pod(v[i]);
+    }
+    void value(const SimTK::Transform& X) {
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j) pod(X.R()(i, j));
+        value(X.p());
+    }
+    template <class T> void array(const Array<T>& a) {
+        size(a.getSize());
+        for (int i = 0; i < a.getSize(); ++i) value(a[i]);
+    }
+
+    void header(const std::string& sourceFileName) {
+        _buffer.append(Magic, sizeof(Magic));
+        pod(FormatVersion);
+        value(GetVersion());
+        pod(static_cast<std::int32_t>(XMLDocument::getLatestVersion()));
+        pod(ObjectSnapshot::computeFileHash(sourceFileName));
+        value(makeAbsolute(sourceFileName));
+    }
+
+    void object(const Object& obj) {
+        value(obj.getConcreteClassName());
+        value(obj.getName());
+        size(obj.getNumProperties());
+        for (int i = 0; i < obj.getNumProperties(); ++i) {
+            const AbstractProperty& prop = obj.getPropertyByIndex(i);
+            value(prop.getName());
+            value(prop.getValueIsDefault());
+            if (const auto* deprecated =
+                    dynamic_cast<const Property_Deprecated*>(&prop))
+                deprecatedProperty(obj, *deprecated);
+            else
+                property(obj, prop);
+        }
+    }
+
+private:
+    template <class T> bool values(const AbstractProperty& prop, ValueKind k) {
+        if (!Property<T>::isA(prop)) return false;
+        const Property<T>& p = Property<T>::getAs(prop);
+        kind(k);
+        size(p.size());
+        for (int i = 0; i < p.size(); ++i) value(p[i]);
+        return true;
+    }
+
+    void property(const Object& obj, const AbstractProperty& prop) {
+        if (prop.isObjectProperty()) {
+            kind(ValueKind::Object);
+            size(prop.size());
+            for (int i = 0; i < prop.size(); ++i)
+                object(prop.getValueAsObject(i));
+            return;
+        }
+        if (values<bool>(prop, ValueKind::Bool) ||
+            values<int>(prop, ValueKind::Int) ||
+            values<double>(prop, ValueKind::Double) ||
+            values<std::string>(prop, ValueKind::String) ||
+            values<SimTK::Vec3>(prop, ValueKind::Vec3) ||
+            values<SimTK::Vec6>(prop, ValueKind::Vec6) ||
+            values<SimTK::Vector>(prop, ValueKind::Vector) ||
+            values<SimTK::Transform>(prop, ValueKind::Transform))
+            return;
+        OPENSIM_THROW(Exception, "ObjectSnapshot: Property " + prop.getName()
+            + " of " + obj.getConcreteClassName() + " " + obj.getName()
+            + " has type " + prop.getTypeName()
+            + ", which cannot be written to a snapshot.");
+    }
+
+    void deprecatedProperty(const Object& obj,
+                            const Property_Deprecated& prop) {
+        kind(ValueKind::Deprecated);
+        pod(static_cast<std::uint8_t>(prop.getType()));
+        switch (prop.getType()) {
+        case Property_Deprecated::Bool: value(prop.getValueBool()); break;
+        case Property_Deprecated::Int:  value(prop.getValueInt());  break;
+        case Property_Deprecated::Dbl:  value(prop.getValueDbl());  break;
+        case Property_Deprecated::Str:  value(prop.getValueStr());  break;
+        case Property_Deprecated::BoolArray:
+            array(prop.getValueBoolArray()); break;
+        case Property_Deprecated::IntArray:
+            array(prop.getValueIntArray()); break;
+        case Property_Deprecated::DblArray:
+        case Property_Deprecated::DblVec:
+        case Property_Deprecated::DblVec3:
+            array(prop.getValueDblArray()); break;
+        case Property_Deprecated::StrArray:
+            array(prop.getValueStrArray()); break;
+        case Property_Deprecated::Transform: {
+            double rotationsAndTranslations[6];
+            dynamic_cast<const PropertyTransform&>(prop).
+                getRotationsAndTranslationsAsArray6(rotationsAndTranslations);
+            for (double v : rotationsAndTranslations) pod(v);
+            break;
+        }
+        case Property_Deprecated::Obj:
+            object(prop.getValueObj()); break;
+        case Property_Deprecated::ObjPtr: {
+            const Object* ptr = prop.getValueObjPtr();
+            value(ptr != nullptr);
+            if (ptr) object(*ptr);
+            break;
+        }
+        case Property_Deprecated::ObjArray:
+            size(prop.getArraySize());
+            for (int i = 0; i < prop.getArraySize(); ++i)
+                object(*prop.getValueObjPtr(i));
+            break;
+        default:
+            OPENSIM_THROW(Exception, "ObjectSnapshot: Property "
+                + prop.getName() + " of " + obj.getConcreteClassName() + " "
+                + obj.getName() + " has type " + prop.getTypeName()
+                + ", which cannot be written to a snapshot.");
+        }
+    }
+
+    std::string _buffer;
+};
+
+//------------------------------------------------------------------------------
+//                                  READER
+//------------------------------------------------------------------------------
+class Reader {
+public:
+    Reader(const std::string& buffer, const std::string& fileName) :
+        _pos(buffer.data()), _end(buffer.data() + buffer.size()),
+        _fileName(fileName) {}
+
+    template <class T> T pod() {
+        OPENSIM_THROW_IF(_end - _pos < static_cast<std::ptrdiff_t>(sizeof(T)),
+            Exception, "ObjectSnapshot: File " + _fileName + " is truncated.");
+        T value;
+        std::memcpy(&value, _pos, sizeof(T));
+        _pos += sizeof(T);
+        return value;
+    }
+    // Read a count of elements that each take at least minBytes of the file.
+    // A count that the rest of the file cannot hold means the file is
+    // corrupt; it must not reach a resize or an allocation.
+    int size(std::size_t minBytes = 1) {
+        const std::uint32_t n = pod<std::uint32_t>();
+        const std::size_t available =
+            static_cast<std::size_t>(_end - _pos) / minBytes;
+        OPENSIM_THROW_IF(n > available ||
+                n > static_cast<std::uint32_t>(
+                        std::numeric_limits<int>::max()),
+            Exception, "ObjectSnapshot: File " + _fileName + " is corrupt "
+            "or truncated.");
+        return static_cast<int>(n);
+    }
+    ValueKind kind() { return static_cast<ValueKind>(pod<std::uint8_t>()); }
+
+    void value(bool& v) { v = pod<std::uint8_t>() != 0; }
+    void value(int& v) { v = pod<std::int32_t>(); }
+    void value(double& v) { v = pod<double>(); }
+    void value(std::string& v) {
+        const int n = size();
+        v.assign(_pos, n);
+        _pos += n;
+    }
+    template <int M> void value(SimTK::Vec<M>& v) {
+        for (int i = 0; i < M; ++i) v[i] = pod<double>();
+    }
+    void value(SimTK::Vector& v) {
+        v.resize(size(sizeof(double)));
+        for (int i = 0; i < v.size(); ++i) v[i] = pod<double>();
+    }
+    void value(SimTK::Transform& X) {
+        SimTK::Mat33 R;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j) R(i, j) = pod<double>();
+        X.updR() = SimTK::Rotation(R, true);
+        value(X.updP());
+    }
+    template <class T> Array<T> array() {
+        Array<T> a;
+        a.setSize(size());
+        for (int i = 0; i < a.getSize(); ++i) {
+            T v;
+            value(v);
+            a[i] = v;
+        }
+        return a;
+    }
+    template <class T> T value() { T v; value(v); return v; }
+
+    bool hasMagic() {
+        if (_end - _pos < static_cast<std::ptrdiff_t>(sizeof(Magic)) ||
+            std::memcmp(_pos, Magic, sizeof(Magic)) != 0)
+            return false;
+        _pos += sizeof(Magic);
+        return true;
+    }
+
+    Header header() {
+        OPENSIM_THROW_IF(!hasMagic(), Exception,
+            "ObjectSnapshot: File " + _fileName + " is not a snapshot.");
+        Header h;
+        h.formatVersion = pod<std::uint32_t>();
+        OPENSIM_THROW_IF(h.formatVersion != FormatVersion, Exception,
+            "ObjectSnapshot: File " + _fileName + " has format version "
+            + std::to_string(h.formatVersion) + " but expected "
+            + std::to_string(FormatVersion) + ".");
+        h.openSimVersion = value<std::string>();
+        h.documentVersion = pod<std::int32_t>();
+        h.sourceHash = pod<std::uint64_t>();
+        h.sourceFileName = value<std::string>();
+        return h;
+    }
+
+    // Read an object record into obj, which must be of the recorded type.
+    void object(Object& obj) {
+        const std::string className = value<std::string>();
+        OPENSIM_THROW_IF(className != obj.getConcreteClassName(), Exception,
+            "ObjectSnapshot: Expected an object of type "
+            + obj.getConcreteClassName() + " in " + _fileName
+            + " but found " + className + ".");
+        objectContents(obj);
+    }
+
+    // Read an object record into a new object of the recorded type.
+    Object* newObject() {
+        const std::string className = value<std::string>();
+        std::unique_ptr<Object> obj(Object::newInstanceOfType(className));
+        OPENSIM_THROW_IF(!obj, Exception,
+            "ObjectSnapshot: Object type " + className + " in " + _fileName
+            + " is not registered.");
+        objectContents(*obj);
+        return obj.release();
+    }
+
+private:
+    void objectContents(Object& obj) {
+        obj.setName(value<std::string>());
+        const int numProperties = size();
+        for (int i = 0; i < numProperties; ++i) {
+            const std::string name = value<std::string>();
+            const bool isDefault = value<bool>();
+            OPENSIM_THROW_IF(!obj.hasProperty(name), Exception,
+                "ObjectSnapshot: " + obj.getConcreteClassName() + " "
+                + obj.getName() + " has no property " + name
+                + " that was recorded in " + _fileName + ".");
+            AbstractProperty& prop = obj.updPropertyByName(name);
+            property(obj, prop);
+            prop.setValueIsDefault(isDefault);
+        }
+        obj.updateFromSnapshot();
+    }
+
+    template <class T> void values(const Object& obj, AbstractProperty& prop) {
+        checkType(obj, prop, Property<T>::isA(prop));
+        Property<T>& p = Property<T>::updAs(prop);
+        const int n = size();
+        p.clear();
+        for (int i = 0; i < n; ++i) p.appendValue(value<T>());
+    }
+
+    void property(const Object& obj, AbstractProperty& prop) {
+        switch (kind()) {
+        case ValueKind::Bool:      values<bool>(obj, prop); break;
+        case ValueKind::Int:       values<int>(obj, prop); break;
+        case ValueKind::Double:    values<double>(obj, prop); break;
+        case ValueKind::String:    values<std::string>(obj, prop); break;
+        case ValueKind::Vec3:      values<SimTK::Vec3>(obj, prop); break;
+        case ValueKind::Vec6:      values<SimTK::Vec6>(obj, prop); break;
+        case ValueKind::Vector:    values<SimTK::Vector>(obj, prop); break;
+        case ValueKind::Transform: values<SimTK::Transform>(obj, prop); break;
+        case ValueKind::Object: {
+            checkType(obj, prop, prop.isObjectProperty());
+            const int n = size();
+            prop.clear();
+            for (int i = 0; i < n; ++i) {
+                std::unique_ptr<Object> value(newObject());
+                prop.adoptAndAppendValueAsObject(value.get());
+                value.release();
+            }
+            break;
+        }
+        case ValueKind::Deprecated: {
+            auto* deprecated = dynamic_cast<Property_Deprecated*>(&prop);
+            checkType(obj, prop, deprecated != nullptr);
+            deprecatedProperty(obj, *deprecated);
+            break;
+        }
+        default:
+            OPENSIM_THROW(Exception, "ObjectSnapshot: File " + _fileName
+                + " is corrupt.");
+        }
+    }
+
+    void deprecatedProperty(const Object& obj, Property_Deprecated& prop) {
+        const auto type =
+            static_cast<Property_Deprecated::PropertyType>(pod<std::uint8_t>());
+        checkType(obj, prop, type == prop.getType());
+        switch (type) {
+        case Property_Deprecated::Bool: prop.setValue(value<bool>()); break;
+        case Property_Deprecated::Int:  prop.setValue(value<int>());  break;
+        case Property_Deprecated::Dbl:  prop.setValue(value<double>()); break;
+        case Property_Deprecated::Str:
+            prop.setValue(value<std::string>()); break;
+        case Property_Deprecated::BoolArray:
+            prop.setValue(array<bool>()); break;
+        case Property_Deprecated::IntArray:
+            prop.setValue(array<int>()); break;
+        case Property_Deprecated::DblArray:
+        case Property_Deprecated::DblVec:
+        case Property_Deprecated::DblVec3:
+            prop.setValue(array<double>()); break;
+        case Property_Deprecated::StrArray:
+            prop.setValue(array<std::string>()); break;
+        case Property_Deprecated::Transform: {
+            double rotationsAndTranslations[6];
+            for (double& v : rotationsAndTranslations) v = pod<double>();
+            prop.setValue(6, rotationsAndTranslations);
+            break;
+        }
+        case Property_Deprecated::Obj:
+            object(prop.getValueObj()); break;
+        case Property_Deprecated::ObjPtr:
+            if (value<bool>()) prop.setValue(newObject());
+            break;
+        case Property_Deprecated::ObjArray: {
+            const int n = size();
+            prop.clearObjArray();
+            for (int i = 0; i < n; ++i) prop.appendValue(newObject());
+            break;
+        }
+        default:
+            OPENSIM_THROW(Exception, "ObjectSnapshot: File " + _fileName
+                + " is corrupt.");
+        }
+    }
+
+    void checkType(const Object& obj, const AbstractProperty& prop,
+                   bool isExpectedType) const {
+        OPENSIM_THROW_IF(!isExpectedType, Exception,
+            "ObjectSnapshot: Property " + prop.getName() + " of "
+            + obj.getConcreteClassName() + " " + obj.getName()
+            + " does not have the type recorded in " + _fileName + ".");
+    }
+
+    const char* _pos;
+    const char* _end;
+    std::string _fileName;
+};
+
+} // anonymous namespace
+
+//=============================================================================
+// WRITE AND READ
+//=============================================================================
+void ObjectSnapshot::write(const Object& obj, const std::string& fileName,
+                           const std::string& sourceFileName)
+{
+    Writer writer;
+    writer.header(sourceFileName);
+    writer.object(obj);
+
+    std::ofstream out(fileName, std::ios::out | std::ios::binary);
+    OPENSIM_THROW_IF(!out, Exception,
+        "ObjectSnapshot: Cannot open file " + fileName + " for writing.");
+    out.write(writer.getBuffer().data(), writer.getBuffer().size());
+    OPENSIM_THROW_IF(!out, Exception,
+        "ObjectSnapshot: Failed to write file " + fileName + ".");
+}
+
+void ObjectSnapshot::read(Object& obj, const std::string& fileName,
+                          bool allowMissingSource)
+{
+    const std::string buffer = readFile(fileName);
+    Reader reader(buffer, fileName);
+    const Header header = reader.header();
+    OPENSIM_THROW_IF(!header.isCompatible(), Exception,
+        "ObjectSnapshot: File " + fileName + " was written by OpenSim "
+        + header.openSimVersion + " and cannot be read by this version ("
+        + GetVersion() + "). Write the snapshot again.");
+
+    if (fileExists(header.sourceFileName)) {
+        OPENSIM_THROW_IF(
+            computeFileHash(header.sourceFileName) != header.sourceHash,
+            Exception, "ObjectSnapshot: " + header.sourceFileName
+            + " has changed since the snapshot " + fileName
+            + " was written. Write the snapshot again.");
+    } else {
+        OPENSIM_THROW_IF(!allowMissingSource, Exception,
+            "ObjectSnapshot: Cannot find " + header.sourceFileName
+            + ", the source of snapshot " + fileName + ", so the snapshot "
+            "cannot be validated.");
+        std::cout << "WARNING: Cannot find " << header.sourceFileName
+                  << ", the source of snapshot " << fileName
+                  << "; the snapshot could not be validated." << std::endl;
+    }
+
+    reader.object(obj);
+}
+
+//=============================================================================
+// UTILITIES
+//=============================================================================
+bool ObjectSnapshot::isSnapshotFile(const std::string& fileName)
+{
+    std::ifstream in(fileName, std::ios::in | std::ios::binary);
+    char magic[sizeof(Magic)];
+    return in.read(magic, sizeof(magic)) &&
+           std::memcmp(magic, Magic, sizeof(Magic)) == 0;
+}
+
+bool ObjectSnapshot::isUpToDate(const std::string& fileName)
+{
+    if (!isSnapshotFile(fileName)) return false;
+    try {
+        const std::string buffer = readFile(fileName);
+        const Header header = Reader(buffer, fileName).header();
+        return header.isCompatible() &&
+               fileExists(header.sourceFileName) &&
+               computeFileHash(header.sourceFileName) == header.sourceHash;
+    } catch (const Exception&) {
+        return false;
+    }
+}
+
+std::string ObjectSnapshot::getSourceFileName(const std::string& fileName)
+{
+    const std::string buffer = readFile(fileName);
+    return Reader(buffer, fileName).header().sourceFileName;
+}
+
+std::uint64_t ObjectSnapshot::computeFileHash(const std::string& fileName)
+{
+    std::ifstream in(fileName, std::ios::in | std::ios::binary);
+    OPENSIM_THROW_IF(!in, Exception,
+        "ObjectSnapshot: Cannot open file " + fileName + ".");
+
+    std::uint64_t hash = 14695981039346656037ULL;
+    char chunk[65536];
+    while (in.read(chunk, sizeof(chunk)) || in.gcount() > 0) {
+        for (std::streamsize i = 0; i < in.gcount(); ++i) {
+            hash ^= static_cast<unsigned char>(chunk[i]);
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
@@ -0,0 +1,96 @@
+#ifndef OPENSIM_OBJECT_SNAPSHOT_H_
+#define OPENSIM_OBJECT_SNAPSHOT_H_
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  ObjectSnapshot.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "osimCommonDLL.h"
+
+#include <cstdint>
+#include <string>
+
+namespace OpenSim {
+
+class Object;
+
+//=============================================================================
+/**
+ * A binary snapshot of the property values of an Object (and, recursively, of
+ * the Objects it contains), as they are after the Object was read from an XML
+ * file. Reading a snapshot skips the XML parsing and the updateFromXMLNode()
+ * chain that brings old files up to the latest format, which dominate the
+ * time it takes to load a large model. Model(fileName) accepts a snapshot
+ * file in place of an .osim file.
+ *
+ * A snapshot records the content hash of the file it was made from. Reading
+ * a snapshot throws if that file has changed or, unless explicitly allowed,
+ * no longer exists; use isUpToDate() to decide whether a snapshot must be
+ * written again.
+ * Snapshots are a cache rather than an exchange format: they can be read only
+ * by the version of OpenSim that wrote them, on a machine of the same byte
+ * order.
+ *
+ * @code
+ * if (!ObjectSnapshot::isUpToDate("subject01.osnap"))
+ *     Model("subject01.osim").printSnapshot("subject01.osnap");
+ * Model model("subject01.osnap");
+ * @endcode
+ */
+class OSIMCOMMON_API ObjectSnapshot {
+public:
+    /** Write the property values of obj to the file fileName. The hash of
+    the contents of sourceFileName, the file from which obj was read, is
+    stored so that the snapshot can be validated when it is read. **/
+    static void write(const Object& obj, const std::string& fileName,
+                      const std::string& sourceFileName);
+
+    /** Replace the name and property values of obj with those stored in the
+    snapshot file fileName. obj must be of the same concrete class as the
+    Object that was written. Throws if the file is not a snapshot, if it was
+    written by a different version of OpenSim, or if its source file has
+    changed since the snapshot was written. Also throws if the source file
+    cannot be found, unless allowMissingSource is true, in which case the
+    snapshot is read without being validated. **/
+    static void read(Object& obj, const std::string& fileName,
+                     bool allowMissingSource = false);
+
+    /** Return true if fileName starts like a snapshot file. **/
+    static bool isSnapshotFile(const std::string& fileName);
+
+    /** Return true if fileName is a snapshot that this version of OpenSim can
+    read and if its source file exists and is unchanged. **/
+    static bool isUpToDate(const std::string& fileName);
+
+    /** Return the absolute path of the file from which the snapshot fileName
+    was made. **/
+    static std::string getSourceFileName(const std::string& fileName);
+
+    /** Return the 64-bit FNV-1a hash of the contents of fileName. **/
+    static std::uint64_t computeFileHash(const std::string& fileName);
+
+//=============================================================================
+};  // END of class ObjectSnapshot
+
+}; //namespace
+//=============================================================================
+//=============================================================================
+
+#endif // OPENSIM_OBJECT_SNAPSHOT_H_
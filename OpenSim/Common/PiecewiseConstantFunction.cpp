@@ -398,9 +398,13 @@ int PiecewiseConstantFunction::addPoint(double aX, double aY)
 }
 
 double PiecewiseConstantFunction::calcValue(const Vector& x) const
+{
+    return calcValue(x[0]);
+}
+
+double PiecewiseConstantFunction::calcValue(double aX) const
 {
     int n = _x.getSize();
-    double aX = x[0];
 
     if (aX < _x[0] || EQUAL_WITHIN_ERROR(aX,_x[0]))
         return _y[0];
@@ -429,6 +433,13 @@ double PiecewiseConstantFunction::calcDerivative(const std::vector<int>& derivCo
     return 0.0;
 }
 
+double PiecewiseConstantFunction::calcDerivative(double aX, int aDerivOrder) const
+{
+    if (aDerivOrder == 0)
+        return calcValue(aX);
+    return 0.0;
+}
+
 int PiecewiseConstantFunction::getArgumentSize() const
 {
     return 1;
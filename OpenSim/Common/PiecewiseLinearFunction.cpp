@@ -312,6 +312,11 @@ void PiecewiseLinearFunction::updateFromXMLNode(SimTK::Xml::Element& aNode, int
     calcCoefficients();
 }   
 
+void PiecewiseLinearFunction::updateFromSnapshot()
+{
+    calcCoefficients();
+}
+
 double PiecewiseLinearFunction::getX(int aIndex) const
 {
     if (aIndex >= 0 && aIndex < _x.getSize())
@@ -425,9 +430,13 @@ void PiecewiseLinearFunction::calcCoefficients()
 }
 
 double PiecewiseLinearFunction::calcValue(const Vector& x) const
+{
+    return calcValue(x[0]);
+}
+
+double PiecewiseLinearFunction::calcValue(double aX) const
 {
     int n = _x.getSize();
-    double aX = x[0];
 
     if (aX < _x[0])
         return _y[0] + (aX - _x[0]) * _b[0];
@@ -464,11 +473,17 @@ double PiecewiseLinearFunction::calcDerivative(const std::vector<int>& derivComp
 {
     if (derivComponents.size() == 0)
         return SimTK::NaN;
-    if (derivComponents.size() > 1)
+    return calcDerivative(x[0], (int)derivComponents.size());
+}
+
+double PiecewiseLinearFunction::calcDerivative(double aX, int aDerivOrder) const
+{
+    if (aDerivOrder == 0)
+        return calcValue(aX);
+    if (aDerivOrder > 1)
         return 0.0;
 
     int n = _x.getSize();
-    double aX = x[0];
 
     if (aX < _x[0]) {
         return _b[0];
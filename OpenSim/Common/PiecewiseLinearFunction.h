@@ -116,11 +116,14 @@ public:
     //--------------------------------------------------------------------------
     double calcValue(const SimTK::Vector& x) const override;
     double calcDerivative(const std::vector<int>& derivComponents, const SimTK::Vector& x) const override;
+    double calcValue(double x) const override;
+    double calcDerivative(double x, int order) const override;
     int getArgumentSize() const override;
     int getMaxDerivativeOrder() const override;
     SimTK::Function* createSimTKFunction() const override;
 
     void updateFromXMLNode(SimTK::Xml::Element& aNode, int versionNumber=-1) override;
+    void updateFromSnapshot() override;
 
 private:
    void calcCoefficients();
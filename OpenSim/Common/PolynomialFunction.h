@@ -100,6 +100,30 @@ public:
         return new SimTK::Function::Polynomial(get_coefficients());
     }
 
+    using Function::calcValue;
+    using Function::calcDerivative;
+
+    /** Evaluate the polynomial at x by Horner's rule. */
+    double calcValue(double x) const override
+    { return calcDerivative(x, 0); }
+
+    /** Evaluate the derivative of the given order of the polynomial at x
+     * by Horner's rule. */
+    double calcDerivative(double x, int order) const override
+    {
+        const SimTK::Vector& c = get_coefficients();
+        const int n = c.size();
+        double value = 0;
+        for (int i = 0; i < n - order; ++i) {
+            // The power of the term with coefficient c[i] is n-1-i.
+            double coefficient = c[i];
+            for (int k = 0; k < order; ++k)
+                coefficient *= n - 1 - i - k;
+            value = value*x + coefficient;
+        }
+        return value;
+    }
+
 private:
     /**
     * Construct the serializable property member variables and
@@ -33,7 +33,9 @@
 #include "SimTKcommon/internal/Array.h"
 #include "SimTKcommon/internal/ClonePtr.h"
 
+#include <atomic>
 #include <iomanip>
+#include <memory>
 
 namespace OpenSim {
 
@@ -803,7 +805,8 @@ template <class T>
 class SimpleProperty : public Property<T> {
 public:
     /** A simple property must have a non-null name. **/
-    SimpleProperty(const std::string& name, bool isOneValue) { 
+    SimpleProperty(const std::string& name, bool isOneValue) 
+    :   sharedValues(std::make_shared<Values>()) { 
         if (name.empty())
             throw OpenSim::Exception(
                 "addProperty<" + std::string(SimTK::NiceTypeName<T>::name())
@@ -812,7 +815,17 @@ public:
         if (isOneValue) this->setAllowableListSize(1); 
     }
 
-    // Default destructor, copy constructor, copy assignment.
+    // Copies share their values until one of them is modified; see
+    // updValues(). Default destructor.
+    SimpleProperty(const SimpleProperty& other)
+    :   Property<T>(other), sharedValues(other.shareValues()) {}
+
+    SimpleProperty& operator=(const SimpleProperty& other) {
+        Property<T>::operator=(other);
+        sharedValues = other.shareValues();
+        valuesAreExposed = false;
+        return *this;
+    }
 
     SimpleProperty* clone() const override final 
     {   return new SimpleProperty(*this); }
@@ -844,7 +857,7 @@ public:
     std::string toStringForDisplay(const int precision) const override final {
         std::stringstream out;
         if (!this->isOneValueProperty()) out << "(";
-        writeSimplePropertyToStreamForDisplay(out, values, precision);
+        writeSimplePropertyToStreamForDisplay(out, getValues(), precision);
         if (!this->isOneValueProperty()) out << ")";
         return out.str();
     }
@@ -854,8 +867,9 @@ public:
     bool isAcceptableObjectTag(const std::string&) const override final 
     {   return false; }
 
-    int getNumValues() const override final {return values.size(); }
-    void clearValues() override final {values.clear();}
+    int getNumValues() const override final {return getValues().size(); }
+    void clearValues() override final 
+    {   sharedValues = std::make_shared<Values>(); }
 
     bool isEqualTo(const AbstractProperty& other) const override final {
         // Check here rather than in base class because the old
@@ -864,8 +878,11 @@ public:
             return false;
         assert(this->size() == other.size()); // base class checked
         const SimpleProperty& otherS = SimpleProperty::getAs(other);
+        const Values& values = getValues();
+        const Values& otherValues = otherS.getValues();
+        if (&values == &otherValues) return true; // shared by copies
         for (int i=0; i<values.size(); ++i)
-            if (!Property<T>::TypeHelper::isEqual(values[i], otherS.values[i]))
+            if (!Property<T>::TypeHelper::isEqual(values[i], otherValues[i]))
                 return false;
         return true;
     }
@@ -883,21 +900,22 @@ public:
             << valstream.str().substr(0,50) // limit displayed length
             << "'.\n";
         }
-        if (values.size() < this->getMinListSize()) {
+        const int numValues = getValues().size();
+        if (numValues < this->getMinListSize()) {
             std::cerr << "Not enough values for " 
             << SimTK::NiceTypeName<T>::name() << " property " << this->getName() 
             << "; input='" << valstream.str().substr(0,50) // limit displayed length 
             << "'. Expected " << this->getMinListSize()
-            << ", got " << values.size() << ".\n";
+            << ", got " << numValues << ".\n";
         }
-        if (values.size() > this->getMaxListSize()) {
+        if (numValues > this->getMaxListSize()) {
             std::cerr << "Too many values for " 
             << SimTK::NiceTypeName<T>::name() << " property " << this->getName() 
             << "; input='" << valstream.str().substr(0,50) // limit displayed length 
             << "'. Expected " << this->getMaxListSize()
-            << ", got " << values.size() << ". Ignoring extras.\n";
+            << ", got " << numValues << ". Ignoring extras.\n";
 
-            values.resize(this->getMaxListSize());
+            updValues().resize(this->getMaxListSize());
         }
     }
 
@@ -930,6 +948,12 @@ public:
                 + this->getName() + " is not an Object property."); 
     }
 
+    int adoptAndAppendValueAsObject(Object* obj) override final {
+        throw OpenSim::Exception(
+                "SimpleProperty<T>::adoptAndAppendValueAsObject(): property " 
+                + this->getName() + " is not an Object property."); 
+    }
+
     static bool isA(const AbstractProperty& prop) 
     {   return dynamic_cast<const SimpleProperty*>(&prop) != NULL; }
 
@@ -962,17 +986,21 @@ private:
     // This is the Property<T> interface implementation.
     // Base class checks the index.
     const T& getValueVirtual(int index) const   override final 
-    {   return values[index]; }
+    {   return getValues()[index]; }
     T& updValueVirtual(int index)               override final 
-    {   return values[index]; }
+    {   Values& values = updValues();
+        valuesAreExposed = true; // caller may write through the reference
+        return values[index]; }
     void setValueVirtual(int index, const T& value) override final
-    {   values[index] = value; }
+    {   updValues()[index] = value; }
     int appendValueVirtual(const T& value)     override final
-    {   values.push_back(value); return values.size()-1; }
+    {   Values& values = updValues();
+        values.push_back(value); return values.size()-1; }
     // Adopting a simple property just means we have to delete the one that
     // gets passed in because the caller thinks we took over ownership.
     int adoptAndAppendValueVirtual(T* valuep)     override final
-    {   values.push_back(*valuep); // make a copy
+    {   Values& values = updValues();
+        values.push_back(*valuep); // make a copy
         delete valuep; // throw out the old one
         return values.size()-1; }
 
@@ -980,19 +1008,44 @@ private:
     // the Simbody default behavior is different than OpenSim's; e.g. for
     // Transform serialization.
     bool readSimplePropertyFromStream(std::istream& in) {
-        return SimTK::readUnformatted(in, values);
+        return SimTK::readUnformatted(in, updValues());
     }
 
     // This is the default implementation; specialization is required if
     // the Simbody default behavior is different than OpenSim's; e.g. for
     // Transform serialization.
     void writeSimplePropertyToStream(std::ostream& o) const {
-        SimTK::writeUnformatted(o, values);
+        SimTK::writeUnformatted(o, getValues());
     }
 
     // This is like an std::vector<T> although with an int index rather
     // than unsigned.
-    SimTK::Array_<T,int> values;
+    typedef SimTK::Array_<T,int> Values;
+
+    const Values& getValues() const { return *sharedValues; }
+
+    // The values are shared by the copies of this property until one of them
+    // is modified (copy on write), so that copying an Object, e.g., cloning a
+    // Model, does not duplicate the values of all its simple properties. Any
+    // access that might modify the values must go through this method.
+    Values& updValues() {
+        if (sharedValues.use_count() > 1)
+            sharedValues = std::make_shared<Values>(*sharedValues);
+        else // Former owners, maybe on other threads, are done reading.
+            std::atomic_thread_fence(std::memory_order_acquire);
+        return *sharedValues;
+    }
+
+    // Once updValue() has handed out a reference into the values, that
+    // reference can modify them at any time, so copies made afterwards get
+    // their own values instead of sharing them.
+    std::shared_ptr<Values> shareValues() const {
+        if (valuesAreExposed) return std::make_shared<Values>(*sharedValues);
+        return sharedValues;
+    }
+
+    std::shared_ptr<Values> sharedValues;
+    bool                    valuesAreExposed = false;
 };
 
 // We have to provide specializations for Transform because read/write
@@ -1004,6 +1057,7 @@ readSimplePropertyFromStream(std::istream& in)
 {   
     // Read in an array of Vec6 objects.
     SimTK::Array_<SimTK::Vec6,int> rotTrans;
+    Values& values = updValues();
     values.clear();
     if (!SimTK::readUnformatted(in, rotTrans)) return false;
 
@@ -1024,6 +1078,7 @@ writeSimplePropertyToStream(std::ostream& o) const
 {   
     // Convert array of Transform objects to an array of Vec6 objects.
     SimTK::Array_<SimTK::Vec6> rotTrans;
+    const Values& values = getValues();
     for (int i = 0; i < values.size(); ++i) {
         convertTransformToVec6(rotTrans, values[i]);
     }
@@ -1040,12 +1095,13 @@ readSimplePropertyFromStream(std::istream& in)
     if(this->getMaxListSize()==1)
     {
         std::istringstream& instream = (std::istringstream&)(in);
+        Values& values = updValues();
         values.clear();
         values.push_back(instream.str());
         return true;
    }
    else
-       return SimTK::readUnformatted(in, values);
+       return SimTK::readUnformatted(in, updValues());
 }
 
 //==============================================================================
@@ -1108,6 +1164,7 @@ public:
     void writeToXMLElement
        (SimTK::Xml::Element& propertyElement) const override final;
     void setValueAsObject(const Object& obj, int index=-1) override final;
+    int adoptAndAppendValueAsObject(Object* obj) override final;
 
     bool isUnnamedProperty() const override final {return isUnnamed;}
     bool isObjectProperty() const override final {return true;}
@@ -166,6 +166,8 @@ public:
     {   Property_PROPERTY_TYPE_MISMATCH(); }
     void setValueAsObject(const Object& obj, int index=-1) override
     {   Property_PROPERTY_TYPE_MISMATCH(); }
+    int adoptAndAppendValueAsObject(Object* obj) override
+    {   Property_PROPERTY_TYPE_MISMATCH(); }
 
     //--------------------------------------------------------------------------
 
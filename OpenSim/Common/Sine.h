@@ -97,6 +97,17 @@ public:
             sin(get_omega()*x[0] + get_phase() + n*SimTK::Pi/2);
     }
 
+    double calcValue(double x) const override {
+        return get_amplitude()*sin(get_omega()*x + get_phase())
+            + get_offset();
+    }
+
+    double calcDerivative(double x, int order) const override {
+        if (order == 0) return calcValue(x);
+        return get_amplitude()*pow(get_omega(),order) *
+            sin(get_omega()*x + get_phase() + order*SimTK::Pi/2);
+    }
+
     SimTK::Function* createSimTKFunction() const override {
         return new FunctionAdapter(*this);
     }
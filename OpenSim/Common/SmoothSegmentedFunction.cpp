@@ -24,6 +24,7 @@
 // INCLUDES
 //=============================================================================
 #include "SmoothSegmentedFunction.h"
+#include <algorithm>
 #include <fstream>
 #include "simmath/internal/SplineFitter.h"
 
@@ -39,9 +40,62 @@ static double UTOL = (double)SimTK::Eps*1e2;
 static double INTTOL = (double)SimTK::Eps*1e2;
 static int MAXITER = 20;
 static int NUM_SAMPLE_PTS = 100;
+static int MAX_TABLE_INTERVALS = 8192;
 //=============================================================================
 // UTILITY FUNCTIONS
 //=============================================================================
+/*
+ Interpolates a lookup table of quintic polynomials (see 
+ SmoothSegmentedFunction::_tableCoefs) at n points. Points outside of [x0,x1]
+ take the linear extrapolation of the curve. The loop body has no branches
+ (the ternaries compile to selects) so that it can be vectorized.
+*/
+template <int ORDER>
+static void interpolateQuinticTable(const double* coefs, int numIntervals,
+    double invH, double x0, double x1, double y0, double y1, 
+    double dydx0, double dydx1, const double* x, double* y, int n)
+{
+    const int last = numIntervals-1;
+    for(int k=0; k < n; k++){
+        const double xk = x[k];
+        const double xc = std::min(std::max(xk, x0), x1);
+        double t = (xc-x0)*invH;
+        const int i = std::min((int)t, last);
+        t -= i;
+        const double* c = coefs + 6*i;
+
+        double yc, ylo, yhi;
+        if(ORDER == 0){
+            yc = c[0]+t*(c[1]+t*(c[2]+t*(c[3]+t*(c[4]+t*c[5]))));
+            ylo = y0 + dydx0*(xk-x0);
+            yhi = y1 + dydx1*(xk-x1);
+        }else if(ORDER == 1){
+            yc = invH*(c[1]+t*(2*c[2]+t*(3*c[3]+t*(4*c[4]+t*5*c[5]))));
+            ylo = dydx0;
+            yhi = dydx1;
+        }else{
+            yc = invH*invH*(2*c[2]+t*(6*c[3]+t*(12*c[4]+t*20*c[5])));
+            ylo = 0;
+            yhi = 0;
+        }
+        y[k] = xk < x0 ? ylo : (xk > x1 ? yhi : yc);
+    }
+}
+
+static void interpolateQuinticTable(const double* coefs, int numIntervals,
+    double invH, double x0, double x1, double y0, double y1, 
+    double dydx0, double dydx1, const double* x, double* y, int n, int order)
+{
+    switch(order){
+    case 0: interpolateQuinticTable<0>(coefs, numIntervals, invH, 
+                x0, x1, y0, y1, dydx0, dydx1, x, y, n); break;
+    case 1: interpolateQuinticTable<1>(coefs, numIntervals, invH, 
+                x0, x1, y0, y1, dydx0, dydx1, x, y, n); break;
+    default: interpolateQuinticTable<2>(coefs, numIntervals, invH, 
+                x0, x1, y0, y1, dydx0, dydx1, x, y, n); break;
+    }
+}
+
 /*
  DETAILED COMPUTATIONAL COSTS:
  =========================================================================
@@ -95,7 +149,8 @@ SmoothSegmentedFunction::
           double x0, double x1, double y0, double y1,double dydx0, double dydx1,
           bool computeIntegral, bool intx0x1, const std::string& name):
 _x0(x0),_x1(x1),_y0(y0),_y1(y1),_dydx0(dydx0),_dydx1(dydx1),
-     _computeIntegral(computeIntegral),_intx0x1(intx0x1),_name(name)
+     _computeIntegral(computeIntegral),_intx0x1(intx0x1),_name(name),
+     _tableSize(0),_tableInvH(0),_tableTolerance(0)
 {
     
 
@@ -166,7 +221,8 @@ _x0(x0),_x1(x1),_y0(y0),_y1(y1),_dydx0(dydx0),_dydx1(dydx1),
  SmoothSegmentedFunction::SmoothSegmentedFunction():
  _x0(SimTK::NaN),_x1(SimTK::NaN),_y0(SimTK::NaN)
      ,_y1(SimTK::NaN),_dydx0(SimTK::NaN),_dydx1(SimTK::NaN),
-     _computeIntegral(false),_intx0x1(false),_name("NOT_YET_SET")
+     _computeIntegral(false),_intx0x1(false),_name("NOT_YET_SET"),
+     _tableSize(0),_tableInvH(0),_tableTolerance(0)
  {
         _arraySplineUX.resize(0);        
         _mXVec.resize(0);
@@ -200,6 +256,11 @@ ________________________________________________________________________
 double SmoothSegmentedFunction::calcValue(double x) const
 {
     double yVal = 0;
+    if(!_tableCoefs.empty()){
+        calcValues(&x, &yVal, 1, 0);
+        return yVal;
+    }
+
     if(x >= _x0 && x <= _x1 )
     {
         int idx  = SegmentedQuinticBezierToolkit::calcIndex(x,_mXVec);
@@ -268,6 +329,8 @@ double SmoothSegmentedFunction::calcDerivative(double x, int order) const
     
     if(order==0){
                 yVal = calcValue(x);
+    }else if(order <= 2 && !_tableCoefs.empty()){
+                calcValues(&x, &yVal, 1, order);
     }else{
             if(x >= _x0 && x <= _x1){        
                 int idx  = SegmentedQuinticBezierToolkit::calcIndex(x,_mXVec);
@@ -323,6 +386,120 @@ double SmoothSegmentedFunction::
     return calcDerivative(ax(0), derivComponents.size());
 }
 
+void SmoothSegmentedFunction::calcValues(const double* x, double* y, int n,
+                                         int derivOrder) const
+{
+    if(derivOrder <= 2 && !_tableCoefs.empty()){
+        interpolateQuinticTable(&_tableCoefs[0], _tableSize, _tableInvH,
+            _x0, _x1, _y0, _y1, _dydx0, _dydx1, x, y, n, derivOrder);
+    }else{
+        for(int i=0; i < n; i++)
+            y[i] = calcDerivative(x[i], derivOrder);
+    }
+}
+
+void SmoothSegmentedFunction::buildLookupTable(double tolerance)
+{
+    SimTK_ERRCHK2_ALWAYS(tolerance > 0,
+        "SmoothSegmentedFunction::buildLookupTable",
+        "%s: tolerance must be positive, but %g was entered",
+        _name.c_str(), tolerance);
+
+    //Evaluate the curve exactly while the table is being built
+    clearLookupTable();
+
+    std::vector<double> knots, coefs;
+    for(int m = 16*_numBezierSections; m <= MAX_TABLE_INTERVALS; m *= 2){
+        const double h = (_x1-_x0)/m;
+        const double invH = 1.0/h;
+
+        //y, h*dy/dx and h^2*d2y/dx2 at the knots
+        knots.resize(3*(m+1));
+        for(int i=0; i <= m; i++){
+            double xi = (i == m) ? _x1 : _x0 + i*h;
+            knots[3*i]   = calcValue(xi);
+            knots[3*i+1] = calcDerivative(xi,1)*h;
+            knots[3*i+2] = calcDerivative(xi,2)*h*h;
+        }
+
+        //Quintic Hermite interpolant of each interval
+        coefs.resize(6*m);
+        for(int i=0; i < m; i++){
+            const double* k0 = &knots[3*i];
+            const double* k1 = &knots[3*(i+1)];
+            const double dp = k1[0]-k0[0];
+            double* c = &coefs[6*i];
+            c[0] = k0[0];
+            c[1] = k0[1];
+            c[2] = 0.5*k0[2];
+            c[3] = 10*dp - 6*k0[1] - 4*k1[1] - 1.5*k0[2] + 0.5*k1[2];
+            c[4] = -15*dp + 8*k0[1] + 7*k1[1] + 1.5*k0[2] - k1[2];
+            c[5] = 6*dp - 3*(k0[1]+k1[1]) - 0.5*(k0[2]-k1[2]);
+        }
+
+        //The interpolation error is largest between the knots
+        bool accurate = true;
+        for(int i=0; i < m && accurate; i++){
+            for(int j=1; j <= 3 && accurate; j++){
+                const double xt = _x0 + (i+0.25*j)*h;
+                for(int order=0; order <= 2 && accurate; order++){
+                    double approx;
+                    interpolateQuinticTable(&coefs[0], m, invH,
+                        _x0, _x1, _y0, _y1, _dydx0, _dydx1,
+                        &xt, &approx, 1, order);
+                    const double exact = calcDerivative(xt,order);
+                    accurate = abs(approx-exact) <= tolerance*(1+abs(exact));
+                }
+            }
+        }
+
+        if(accurate){
+            _tableCoefs.swap(coefs);
+            _tableSize = m;
+            _tableInvH = invH;
+            _tableTolerance = tolerance;
+            return;
+        }
+    }
+
+    SimTK_ERRCHK3_ALWAYS(false,
+        "SmoothSegmentedFunction::buildLookupTable",
+        "%s: a lookup table of at most %i intervals cannot reproduce the "
+        "curve to a tolerance of %g", _name.c_str(), MAX_TABLE_INTERVALS,
+        tolerance);
+}
+
+void SmoothSegmentedFunction::clearLookupTable()
+{
+    _tableCoefs.clear();
+    _tableSize = 0;
+    _tableInvH = 0;
+    _tableTolerance = 0;
+}
+
+bool SmoothSegmentedFunction::isLookupTableAvailable() const
+{
+    return !_tableCoefs.empty();
+}
+
+void SmoothSegmentedFunction::setLookupTableTolerance(double tolerance)
+{
+    SimTK_ERRCHK2_ALWAYS(tolerance >= 0,
+        "SmoothSegmentedFunction::setLookupTableTolerance",
+        "%s: tolerance must be 0 or positive, but %g was entered",
+        _name.c_str(), tolerance);
+
+    if(tolerance > 0)
+        buildLookupTable(tolerance);
+    else
+        clearLookupTable();
+}
+
+double SmoothSegmentedFunction::getLookupTableTolerance() const
+{
+    return _tableTolerance;
+}
+
 /*Detailed Computational Costs
 ________________________________________________________________________
 If x is in the Bezier Curve, and dy/dx is being evaluated
@@ -24,6 +24,7 @@
  * -------------------------------------------------------------------------- */
 #include "osimCommonDLL.h"
 #include "SegmentedQuinticBezierToolkit.h"
+#include <vector>
 
 namespace OpenSim { 
 
@@ -132,6 +133,69 @@ namespace OpenSim {
        using Function_<double>::calcDerivative;
 #endif
 
+       /**Evaluates the curve, or one of its derivatives, at a batch of domain 
+       points. This gives the same results as calling calcDerivative(x[i],
+       derivOrder) for each point, but it is cheaper when a lookup table has 
+       been built (see buildLookupTable()): the points are then interpolated 
+       in a single loop without branches that compilers can vectorize.
+
+       @param x          The n domain points of interest.
+       @param y          The n values of the d^ny/dx^n th derivative at x.
+                         May be the same array as x.
+       @param n          The number of points.
+       @param derivOrder The order of the derivative to compute, between 0 
+                         and 6. The lookup table is used for orders 0 to 2.
+
+       <B>Computational Costs</B>
+       \verbatim
+            with a lookup table (per point)   : ~25 flops
+            without a lookup table (per point): see calcDerivative
+       \endverbatim
+       */
+       void calcValues(const double* x, double* y, int n, 
+                       int derivOrder) const;
+
+       /**Tabulates the curve so that calcValue(), calcValues() and 
+       calcDerivative() (up to the 2nd derivative) interpolate the table 
+       instead of solving for the Bezier parameter u(x) of each point. The
+       table stores y, dy/dx and d2y/dx2 on a uniform grid that spans the 
+       curve domain; between grid points the curve is interpolated with a 
+       quintic Hermite polynomial, so the interpolant is C2 continuous. The
+       grid is refined until, between every pair of grid points, the value 
+       and the first two derivatives of the interpolant differ from those of 
+       the curve by less than tolerance*(1+|exact|).
+
+       @param tolerance The accuracy required of the table (e.g. 1e-9).
+       @throws SimTK::Exception
+        -If tolerance is not positive
+        -If a table of at most 8192 intervals cannot reach the tolerance
+
+       <B>Computational Costs</B>
+       \verbatim
+            ~10,000 flops per interval of the final table
+       \endverbatim
+       */
+       void buildLookupTable(double tolerance);
+
+       /**Discards the lookup table so that the curve is evaluated exactly.*/
+       void clearLookupTable();
+
+       /**@return true if buildLookupTable() has tabulated this curve*/
+       bool isLookupTableAvailable() const;
+
+       /**Builds a lookup table of the given tolerance (see 
+       buildLookupTable()), or, if tolerance is 0, clears it.
+
+       @param tolerance The accuracy required of the table, or 0.
+       @throws SimTK::Exception
+        -If tolerance is negative
+        -If a table of at most 8192 intervals cannot reach the tolerance
+       */
+       void setLookupTableTolerance(double tolerance);
+
+       /**@return the tolerance of the lookup table, or 0 if there is none*/
+       double getLookupTableTolerance() const;
+
 
        /**This will return the value of the integral of this objects curve 
        evaluated at x. 
@@ -344,6 +408,18 @@ namespace OpenSim {
         bool _intx0x1;
         /**The name of the function**/
         std::string _name;
+
+        /**Coefficients of the quintic polynomials that interpolate y(x) over 
+        each interval of the lookup table, in the local coordinate 
+        t = (x-x0)/h - i of interval i. Each interval stores 6 coefficients, 
+        the constant one first. Empty if there is no lookup table.*/
+        std::vector<double> _tableCoefs;
+        /**The number of intervals of the lookup table*/
+        int _tableSize;
+        /**The inverse of the width, h, of the lookup table intervals*/
+        double _tableInvH;
+        /**The tolerance to which the lookup table was built*/
+        double _tableTolerance;
             
         /**No human should be constructing a SmoothSegmentedFunction, so the
         constructor is made private so that mere mortals cannot look at it. 
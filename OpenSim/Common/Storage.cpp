@@ -28,6 +28,7 @@
 
 // INCLUDES
 #include <iostream>
+#include <algorithm>
 #include "IO.h"
 #include "Signal.h"
 #include "Storage.h"
@@ -1207,11 +1208,11 @@ getDataColumn(int aStateIndex,double *&rData) const
     }
 
     // ASSIGNMENT
-    int i,nData;
-    for(i=nData=0;i<n;i++) {
-        StateVector *vec = getStateVector(i);
-        if(vec==NULL) continue;
-        if(vec->getDataValue(aStateIndex,rData[nData])) nData++;
+    int nData = 0;
+    if(aStateIndex<0) return(nData);
+    for(int i=0;i<n;i++) {
+        const Array<double>& data = _storage[i].getData();
+        if(aStateIndex<data.getSize()) rData[nData++] = data[aStateIndex];
     }
 
     return(nData);
@@ -1225,11 +1226,13 @@ getDataColumn(int aStateIndex,Array<double> &rData) const
     rData.setSize(n);
 
     // ASSIGNMENT
-    int i,nData;
-    for(i=nData=0;i<n;i++) {
-        StateVector *vec = getStateVector(i);
-        if(vec==NULL) continue;
-        if(vec->getDataValue(aStateIndex,rData[nData])) nData++;
+    int nData = 0;
+    if(aStateIndex>=0) {
+        double *column = rData.get();
+        for(int i=0;i<n;i++) {
+            const Array<double>& data = _storage[i].getData();
+            if(aStateIndex<data.getSize()) column[nData++] = data[aStateIndex];
+        }
     }
 
     rData.setSize(nData);
@@ -1282,6 +1285,47 @@ setDataColumn(int aStateIndex,const Array<double> &aData)
         vec->setDataValue(aStateIndex,aData[i]);
     }
 }
+//_____________________________________________________________________________
+/**
+ * Copy the times and the columns shared by all rows into contiguous,
+ * column-major buffers.
+ */
+int Storage::
+getDataBlock(std::vector<double>& rTimes, std::vector<double>& rData) const
+{
+    int n = _storage.getSize();
+    int nc = getSmallestNumberOfStates();
+    rTimes.resize(n);
+    rData.resize((size_t)n*nc);
+
+    for(int i=0;i<n;i++) {
+        const StateVector& vec = _storage[i];
+        rTimes[i] = vec.getTime();
+        const double *y = vec.getData().get();
+        double *column = rData.data() + i;
+        for(int j=0;j<nc;j++,column+=n) *column = y[j];
+    }
+
+    return(nc);
+}
+//_____________________________________________________________________________
+/**
+ * Write the first aNumColumns columns of a column-major block back into the
+ * rows.
+ */
+void Storage::
+setDataBlock(int aNumColumns, const std::vector<double>& aData)
+{
+    int n = _storage.getSize();
+    assert(aData.size() >= (size_t)n*aNumColumns);
+
+    for(int i=0;i<n;i++) {
+        double *y = _storage[i].getData().get();
+        const double *column = aData.data() + i;
+        for(int j=0;j<aNumColumns;j++,column+=n) y[j] = *column;
+    }
+}
+
 /**
  * set values in the column specified by columnName to newValue
  */
@@ -1385,6 +1429,7 @@ TimeSeriesTable Storage::exportToTable() const {
     table.setColumnLabels(_columnLabels.get() + 1, 
                           _columnLabels.get() + _columnLabels.getSize());
 
+    table.reserveRows(_storage.getSize());
     for(int i = 0; i < _storage.getSize(); ++i) {
         const auto& row = getStateVector(i)->getData();
         const auto time = getStateVector(i)->getTime();
@@ -1893,11 +1938,10 @@ multiply(Storage *aStorage)
 void Storage::
 multiplyColumn(int aIndex, double aValue)
 {
-    double newValue;
+    if(aIndex<0) return;
     for(int i=0;i<_storage.getSize();i++) {
-        _storage[i].getDataValue(aIndex, newValue);
-        newValue *= aValue;
-        _storage[i].setDataValue(aIndex, newValue);
+        Array<double>& data = _storage[i].getData();
+        if(aIndex<data.getSize()) data[aIndex] *= aValue;
     }
 }
 
@@ -2359,33 +2403,36 @@ void Storage::
 pad(int aPadSize)
 {
     if (aPadSize==0) return; //Nothing to do
+    int size = getSize();
+    if (size==0) return;
+    std::vector<double> times, data;
+    int nc = getDataBlock(times,data);
+
     // PAD THE TIME COLUMN
-    Array<double> paddedTime;
-    int size = getTimeColumn(paddedTime);
+    Array<double> paddedTime(0.0,size);
+    std::copy(times.begin(),times.end(),paddedTime.get());
     Signal::Pad(aPadSize,paddedTime);
     int newSize = paddedTime.getSize();
 
     // PAD EACH COLUMN
-    int nc = getSmallestNumberOfStates();
+    std::vector<double> paddedData((size_t)newSize*nc);
     Array<double> paddedSignal(0.0,size);
-    StateVector *vecs = new StateVector[newSize];
-    for(int j=0;j<newSize;j++) {
-        vecs[j].getData().setSize(nc);
-        vecs[j].setTime(paddedTime[j]);
-    }
     for(int i=0;i<nc;i++) {
-        getDataColumn(i,paddedSignal);
+        paddedSignal.setSize(size);
+        std::copy(&data[(size_t)i*size],&data[(size_t)(i+1)*size],
+                  paddedSignal.get());
         Signal::Pad(aPadSize,paddedSignal);
-        for(int j=0;j<newSize;j++)
-            vecs[j].setDataValue(i,paddedSignal[j]);
+        std::copy(paddedSignal.get(),paddedSignal.get()+newSize,
+                  &paddedData[(size_t)i*newSize]);
     }
 
-    // APPEND THE STATEVECTORS
-    _storage.setSize(0);
-    for(int i=0;i<newSize;i++) _storage.append(vecs[i]);
-
-    // CLEANUP
-    delete[] vecs;
+    // REPLACE THE STATEVECTORS
+    _storage.setSize(newSize);
+    for(int j=0;j<newSize;j++) {
+        _storage[j].setTime(paddedTime[j]);
+        _storage[j].getData().setSize(nc);
+    }
+    setDataBlock(nc,paddedData);
 }
 
 void Storage::
@@ -2412,20 +2459,14 @@ smoothSpline(int aOrder,double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    double *times=NULL;
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
-    getTimeColumn(times,0);
+    std::vector<double> times, data;
+    int nc = getDataBlock(times,data);
+    std::vector<double> filt(data.size());
     for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::SmoothSpline(aOrder,dtmin,aCutoffFrequency,size,times,signal,&filt[0]);
-        setDataColumn(i,filt);
+        Signal::SmoothSpline(aOrder,dtmin,aCutoffFrequency,size,&times[0],
+                             &data[(size_t)i*size],&filt[(size_t)i*size]);
     }
-
-    // CLEANUP
-    delete[] times;
-    delete[] signal;
+    setDataBlock(nc,filt);
 }
 
 void Storage::
@@ -2452,17 +2493,14 @@ lowpassIIR(double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
+    std::vector<double> times, data;
+    int nc = getDataBlock(times,data);
+    std::vector<double> filt(data.size());
     for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::LowpassIIR(dtmin,aCutoffFrequency,size,signal,&filt[0]);
-        setDataColumn(i,filt);
+        Signal::LowpassIIR(dtmin,aCutoffFrequency,size,
+                           &data[(size_t)i*size],&filt[(size_t)i*size]);
     }
-
-    // CLEANUP
-    delete[] signal;
+    setDataBlock(nc,filt);
 }
 
 void Storage::
@@ -2489,17 +2527,14 @@ lowpassFIR(int aOrder,double aCutoffFrequency)
     }
 
     // LOOP OVER COLUMNS
-    int nc = getSmallestNumberOfStates();
-    double *signal=NULL;
-    Array<double> filt(0.0,size);
+    std::vector<double> times, data;
+    int nc = getDataBlock(times,data);
+    std::vector<double> filt(data.size());
     for(int i=0;i<nc;i++) {
-        getDataColumn(i,signal);
-        Signal::LowpassFIR(aOrder,dtmin,aCutoffFrequency,size,signal,&filt[0]);
-        setDataColumn(i,filt);
+        Signal::LowpassFIR(aOrder,dtmin,aCutoffFrequency,size,
+                           &data[(size_t)i*size],&filt[(size_t)i*size]);
     }
-
-    // CLEANUP
-    delete[] signal;
+    setDataBlock(nc,filt);
 }
 
 
@@ -2669,31 +2704,57 @@ resampleLinear(double aDT)
  */
 void Storage::interpolateAt(const Array<double> &targetTimes)
 {
+    int n = getSize();
+    if (n==0) return;
+
+    // Existing times, for the binary searches below.
+    std::vector<double> times(n);
+    for(int i=0; i<n; i++) times[i] = _storage[i].getTime();
+
+    // Collect the rows to insert along with the index of the existing row
+    // that each is inserted after. A target time that is within 1e-6 of a
+    // neighboring row, or of a row already collected, is skipped.
+    std::vector<std::pair<int, double> > inserts;
     for(int i=0; i<targetTimes.getSize();i++){
         double t = targetTimes[i];
-        // get index for t
-        int tIndex = findIndex(t);
-        // If within small number from t then pass
-        double actualTime=0.0;
-        if (tIndex < getSize()-1){
-            getTime(tIndex+1, actualTime);
-            if (fabs(actualTime - t)<1e-6) 
-                    continue;
+        int tIndex = std::max(0, (int)(std::upper_bound(times.begin(),
+                times.end(), t) - times.begin()) - 1);
+        if (tIndex < n-1 && fabs(times[tIndex+1] - t)<1e-6)
+            continue;
+        if (fabs(times[tIndex] - t)<1e-6)
+            continue;
+        bool duplicate = false;
+        for(const auto& insert : inserts) {
+            if (insert.first == tIndex && fabs(insert.second - t)<1e-6) {
+                duplicate = true;
+                break;
+            }
         }
-        // or could be the following one too
-        getTime(tIndex, actualTime);
-        if (fabs(actualTime - t)<1e-6) 
-                continue;
-        // create a StateVector and add it
-        double *y=NULL;
-        int ny=0;
-        StateVector vec;
-        // INTERPOLATE THE STATES
-        ny = getDataAtTime(t,ny,&y);
-        vec.setStates(t, SimTK::Vector_<double>(ny, y));
+        if (!duplicate) inserts.push_back(std::make_pair(tIndex, t));
+    }
+    if (inserts.empty()) return;
+    std::stable_sort(inserts.begin(), inserts.end());
 
-        _storage.insert(tIndex+1, vec);
+    // Merge the interpolated rows with the existing ones in a single pass
+    // instead of shifting the rows once per inserted row.
+    Array<StateVector> merged;
+    merged.ensureCapacity(n + (int)inserts.size());
+    double *y=NULL;
+    int ny=0;
+    size_t k = 0;
+    for(int i=0; i<n; i++) {
+        merged.append(_storage[i]);
+        for(; k<inserts.size() && inserts[k].first==i; k++) {
+            // INTERPOLATE THE STATES
+            double t = inserts[k].second;
+            ny = getDataAtTime(t,ny,&y);
+            StateVector vec;
+            vec.setStates(t, SimTK::Vector_<double>(ny, y));
+            merged.append(vec);
+        }
     }
+    delete[] y;
+    _storage = merged;
 }
 //=============================================================================
 // IO
@@ -374,6 +374,18 @@ private:
     int writeColumnLabels(FILE *rFP) const;
     int integrate(double aTI,double aTF,int aN,double *rArea,Storage *rStorage) const;
     int integrate(int aI1,int aI2,int aN,double *rArea,Storage *rStorage) const;
+    /** Copy the times and the first getSmallestNumberOfStates() states of
+    all rows into contiguous buffers in a single pass over the rows. rData
+    is column-major: column j occupies rData[j*getSize()] through
+    rData[(j+1)*getSize()-1]. Whole-table operations work on these buffers
+    so that each column is processed in one linear sweep.
+    @return The number of columns copied. */
+    int getDataBlock(std::vector<double>& rTimes,
+                     std::vector<double>& rData) const;
+    /** Write the first aNumColumns columns of a column-major block (see
+    getDataBlock()) back into the rows in a single pass. The block must have
+    getSize() rows. */
+    void setDataBlock(int aNumColumns, const std::vector<double>& aData);
 
 //=============================================================================
 };  // END of class Storage
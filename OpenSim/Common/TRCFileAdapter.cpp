@@ -44,21 +44,31 @@ TRCFileAdapter::extendRead(const std::string& fileName) const {
     OPENSIM_THROW_IF(fileName.empty(),
                      EmptyFileName);
 
-    std::ifstream in_stream{fileName};
-    OPENSIM_THROW_IF(!in_stream.good(),
-                     FileDoesNotExist,
-                     fileName);
+    // Read the whole file at once and parse it in place. This avoids
+    // allocating a string for every line and token of the file.
+    const std::string contents = readFileContents(fileName);
+    const char* pos = contents.data();
+    const char* const end = contents.data() + contents.size();
 
     auto table = std::make_shared<TimeSeriesTableVec3>();
 
-    // Callable to get the next line in form of vector of tokens.
+    // Tokens of the current line. Reused for every line.
+    std::vector<TokenRange> tokens{};
+
+    // Callable to get the next line in form of vector of tokens. Only used
+    // for the few lines preceding the data.
     auto nextLine = [&] {
-        return getNextLine(in_stream, _delimitersRead);
+        getNextLine(pos, end, _delimitersRead, tokens);
+        std::vector<std::string> line{};
+        for(const auto& token : tokens)
+            line.emplace_back(token.first, token.second);
+        return line;
     };
 
     // First line of the stream is considered the header.
-    std::string header{};
-    std::getline(in_stream, header);
+    TokenRange header_range{};
+    getNextLine(pos, end, header_range);
+    const std::string header{header_range.first, header_range.second};
     auto header_tokens = tokenize(header, _delimitersRead);
     OPENSIM_THROW_IF(header_tokens.empty(),
                      FileIsEmpty,
@@ -146,43 +156,44 @@ TRCFileAdapter::extendRead(const std::string& fileName) const {
         }
     }
 
+    // Set the column labels of the table.
+    ValueArray<std::string> value_array{};
+    for(const auto& cl : column_labels)
+        value_array.upd().push_back(SimTK::Value<std::string>{cl});
+    TimeSeriesTableVec3::DependentsMetaData dep_metadata{};
+    dep_metadata.setValueArrayForKey("labels", value_array);
+    table->setDependentsMetaData(dep_metadata);
+
+    // Every remaining line holds at most one row; reserve room for all of them
+    // so that appending rows does not reallocate.
+    table->reserveRows(countLines(pos, end));
+
     // Read the rows one at a time and fill up the time column container and
     // the data container.
     std::size_t line_num{_dataStartsAtLine - 1};
-    auto row = nextLine();
-    while(!row.empty()) {
+    const size_t expected{column_labels.size() * 3 + 2};
+    TimeSeriesTableVec3::RowVector 
+        row_vector{static_cast<int>(num_markers_expected)};
+    while(getNextLine(pos, end, _delimitersRead, tokens)) {
         ++line_num;
-        size_t expected{column_labels.size() * 3 + 2};
-        OPENSIM_THROW_IF(row.size() != expected,
+        OPENSIM_THROW_IF(tokens.size() != expected,
                          RowLengthMismatch,
                          fileName,
                          line_num,
                          expected,
-                         row.size());
+                         tokens.size());
 
         // Columns 2 till the end are data.
-        TimeSeriesTableVec3::RowVector 
-            row_vector{static_cast<int>(num_markers_expected)};
         int ind{0};
-        for(std::size_t c = 2; c < column_labels.size() * 3 + 2; c += 3)
-            row_vector[ind++] = SimTK::Vec3{std::stod(row.at(c)),
-                                            std::stod(row.at(c+1)),
-                                            std::stod(row.at(c+2))};
+        for(std::size_t c = 2; c < expected; c += 3)
+            row_vector[ind++] = SimTK::Vec3{parseDouble(tokens[c]),
+                                            parseDouble(tokens[c+1]),
+                                            parseDouble(tokens[c+2])};
 
         // Column 1 is time.
-        table->appendRow(std::stod(row.at(1)), std::move(row_vector));
-
-        row = nextLine();
+        table->appendRow(parseDouble(tokens[1]), row_vector);
     }
 
-    // Set the column labels of the table.
-    ValueArray<std::string> value_array{};
-    for(const auto& cl : column_labels)
-        value_array.upd().push_back(SimTK::Value<std::string>{cl});
-    TimeSeriesTableVec3::DependentsMetaData dep_metadata{};
-    dep_metadata.setValueArrayForKey("labels", value_array);
-    table->setDependentsMetaData(dep_metadata);
-
     OutputTables output_tables{};
     output_tables.emplace(_markers, table);
 
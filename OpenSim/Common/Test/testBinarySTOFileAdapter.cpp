@@ -0,0 +1,165 @@
+/* -------------------------------------------------------------------------- *
+ *                  OpenSim:  testBinarySTOFileAdapter.cpp                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "OpenSim/Common/Adapters.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+using namespace OpenSim;
+
+// Compare two tables element by element, bit for bit.
+template<typename ETY>
+void compareTables(const TimeSeriesTable_<ETY>& expected,
+                   const TimeSeriesTable_<ETY>& received) {
+    SimTK_TEST(expected.getColumnLabels() == received.getColumnLabels());
+    SimTK_TEST(expected.getIndependentColumn() ==
+               received.getIndependentColumn());
+    SimTK_TEST(expected.getNumRows() == received.getNumRows());
+    for(size_t r = 0; r < expected.getNumRows(); ++r) {
+        const auto& rowA = expected.getRowAtIndex(r);
+        const auto& rowB = received.getRowAtIndex(r);
+        for(int c = 0; c < rowA.ncol(); ++c)
+            SimTK_TEST(std::memcmp(&rowA[c], &rowB[c], sizeof(ETY)) == 0);
+    }
+}
+
+template<typename ETY>
+void testReadingWriting() {
+    // Values that do not survive a round trip through text with the default
+    // precision; Quaternions are deliberately not normalized.
+    const int numRows = 101;
+    const int numColumns = 7;
+    std::vector<double> times{};
+    SimTK::Matrix_<ETY> data{numRows, numColumns};
+    double value = 1.0/3.0;
+    for(int r = 0; r < numRows; ++r) {
+        times.push_back(0.01*r + 1e-13);
+        for(int c = 0; c < numColumns; ++c) {
+            double* elem = reinterpret_cast<double*>(&data.updElt(r, c));
+            for(size_t k = 0; k < sizeof(ETY)/sizeof(double); ++k) {
+                elem[k] = value;
+                value = -1.000001*value + 1e-7;
+            }
+        }
+    }
+    std::vector<std::string> labels{};
+    for(int c = 0; c < numColumns; ++c)
+        labels.push_back("col" + std::to_string(c));
+    TimeSeriesTable_<ETY> table{times, data, labels};
+    table.updTableMetaData().setValueForKey("inDegrees",
+                                            std::string{"no"});
+    table.updTableMetaData().setValueForKey("DataRate", 100);
+
+    const std::string fileName{"testBinarySTOFileAdapter.stob"};
+    BinarySTOFileAdapter::write(table, fileName);
+
+    // The whole table.
+    auto copy = BinarySTOFileAdapter::read<ETY>(fileName);
+    compareTables(table, copy);
+    SimTK_TEST(copy.template getTableMetaData<std::string>("inDegrees")
+               == "no");
+    // Only string metadata is stored.
+    SimTK_TEST(!copy.getTableMetaData().hasKey("DataRate"));
+
+    // Through the adapter registry.
+    auto absTable = FileAdapter::readFile(fileName).at("table");
+    compareTables(table,
+                  dynamic_cast<const TimeSeriesTable_<ETY>&>(*absTable));
+    {
+        DataAdapter::InputTables tables{};
+        tables.emplace(std::string{"table"}, &table);
+        FileAdapter::writeFile(tables, fileName);
+        compareTables(table, BinarySTOFileAdapter::read<ETY>(fileName));
+    }
+
+    // Some columns over a range of times.
+    auto slice = BinarySTOFileAdapter::read<ETY>(fileName, {"col5", "col2"},
+                                                 0.2, 0.45);
+    SimTK_TEST(slice.getNumRows() == 25);
+    SimTK_TEST((slice.getColumnLabels() ==
+                std::vector<std::string>{"col5", "col2"}));
+    for(size_t r = 0; r < slice.getNumRows(); ++r) {
+        SimTK_TEST(slice.getIndependentColumn()[r] == times[20 + r]);
+        SimTK_TEST(std::memcmp(&slice.getRowAtIndex(r)[0],
+                               &data(20 + (int)r, 5), sizeof(ETY)) == 0);
+        SimTK_TEST(std::memcmp(&slice.getRowAtIndex(r)[1],
+                               &data(20 + (int)r, 2), sizeof(ETY)) == 0);
+    }
+    SimTK_TEST(BinarySTOFileAdapter::read<ETY>(fileName, {}, 5, 6).
+               getNumRows() == 0);
+    SimTK_TEST_MUST_THROW_EXC(
+        BinarySTOFileAdapter::read<ETY>(fileName, {"nonexistent"}),
+        KeyNotFound);
+
+    std::remove(fileName.c_str());
+}
+
+int main() {
+    SimTK_START_TEST("testBinarySTOFileAdapter");
+        SimTK_SUBTEST(testReadingWriting<double>);
+        SimTK_SUBTEST(testReadingWriting<SimTK::Vec2>);
+        SimTK_SUBTEST(testReadingWriting<SimTK::Vec3>);
+        SimTK_SUBTEST(testReadingWriting<SimTK::Vec6>);
+        SimTK_SUBTEST(testReadingWriting<SimTK::UnitVec3>);
+        SimTK_SUBTEST(testReadingWriting<SimTK::Quaternion>);
+        SimTK_SUBTEST(testReadingWriting<SimTK::SpatialVec>);
+
+        // Tables of one type cannot be read as tables of another.
+        {
+            TimeSeriesTable_<SimTK::Vec3> table{std::vector<double>{0, 1}};
+            table.appendColumn("a", std::vector<SimTK::Vec3>(2,
+                                                SimTK::Vec3(1, 2, 3)));
+            BinarySTOFileAdapter::write(table, "testBinarySTO_vec3.stob");
+            SimTK_TEST_MUST_THROW_EXC(BinarySTOFileAdapter::read<double>(
+                                        "testBinarySTO_vec3.stob"),
+                                      DataTypeMismatch);
+
+            // Truncated and foreign files are detected.
+            std::ofstream truncated{"testBinarySTO_truncated.stob",
+                                    std::ios::binary};
+            std::ifstream original{"testBinarySTO_vec3.stob",
+                                   std::ios::binary};
+            std::string contents{std::istreambuf_iterator<char>(original),
+                                 std::istreambuf_iterator<char>()};
+            truncated.write(contents.data(), contents.size() - 8);
+            truncated.close();
+            SimTK_TEST_MUST_THROW_EXC(BinarySTOFileAdapter::read<SimTK::Vec3>(
+                                        "testBinarySTO_truncated.stob"),
+                                      IOError);
+            std::ofstream text{"testBinarySTO_text.stob"};
+            text << "header\nendheader\ntime\tcol\n0\t1\n";
+            text.close();
+            SimTK_TEST_MUST_THROW_EXC(BinarySTOFileAdapter::read<double>(
+                                        "testBinarySTO_text.stob"),
+                                      IOError);
+            SimTK_TEST_MUST_THROW_EXC(BinarySTOFileAdapter::read<double>(
+                                        "testBinarySTO_nonexistent.stob"),
+                                      FileDoesNotExist);
+            std::remove("testBinarySTO_vec3.stob");
+            std::remove("testBinarySTO_truncated.stob");
+            std::remove("testBinarySTO_text.stob");
+        }
+    SimTK_END_TEST();
+}
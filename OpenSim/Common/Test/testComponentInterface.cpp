@@ -1140,6 +1140,39 @@ void testTraversePathToComponent() {
     B* btx = new B("tx");
     atx->addComponent(btx);
     SimTK_TEST(&top.getComponent<Component>("tx/tx") == btx);
+
+    // The path index of the root stays up to date.
+    // --------------------------------------------
+    // Renaming.
+    a2->setName("a2renamed");
+    SimTK_TEST(!top.hasComponent("a1/a2"));
+    SimTK_TEST(&top.getComponent<A>("/top/a1/a2renamed") == a2);
+    SimTK_TEST(&b2->getComponent<A>("../a2renamed") == a2);
+    a2->setName("a2");
+    SimTK_TEST(&top.getComponent<A>("a1/a2") == a2);
+    // Adding.
+    B* b3 = new B("b3");
+    a2->addComponent(b3);
+    SimTK_TEST(&top.getComponent<B>("a1/a2/b3") == b3);
+    SimTK_TEST(&b1->getComponent<B>("../a1/a2/b3") == b3);
+    // Searching by name.
+    SimTK_TEST(top.findComponent<B>("b3") == b3);
+    SimTK_TEST(a1->findComponent<B>("b3") == b3);
+    SimTK_TEST(b1->findComponent<B>("b3") == nullptr);
+    SimTK_TEST(top.findComponent<A>("b3") == nullptr);
+    // Naming a component that has no name.
+    b3->setName("");
+    SimTK_TEST(!top.hasComponent("a1/a2/b3"));
+    b3->setName("b4");
+    SimTK_TEST(&top.getComponent<B>("a1/a2/b4") == b3);
+    b3->setName("b3");
+    // A copy has its own index.
+    A topCopy(top);
+    topCopy.finalizeFromProperties();
+    const auto& b3Copy = topCopy.getComponent<B>("a1/a2/b3");
+    SimTK_TEST(&b3Copy != b3);
+    SimTK_TEST(&b3Copy.getComponent<A>("/top") == &topCopy);
+    SimTK_TEST(topCopy.findComponent<B>("b3") == &b3Copy);
 }
 
 void testGetStateVariableValue() {
@@ -1280,6 +1313,64 @@ void testInputOutputConnections()
     }
 }
 
+void testOutputMemoization()
+{
+    class Counter : public Component {
+        OpenSim_DECLARE_CONCRETE_OBJECT(Counter, Component);
+    public:
+        OpenSim_DECLARE_OUTPUT(twice_time, double, calcTwiceTime,
+                SimTK::Stage::Time);
+        double calcTwiceTime(const SimTK::State& s) const {
+            ++numCalls;
+            return 2 * s.getTime();
+        }
+        mutable int numCalls = 0;
+    };
+
+    TheWorld world;
+    Counter* counter = new Counter();
+    counter->setName("counter");
+    world.add(counter);
+    MultibodySystem system;
+    world.connect();
+    world.buildUpSystem(system);
+    State s = system.realizeTopology();
+
+    // Below Stage::Dynamics, the value is computed on every read.
+    s.setTime(1.0);
+    system.realize(s, Stage::Time);
+    SimTK_TEST(counter->getOutputValue<double>(s, "twice_time") == 2.0);
+    SimTK_TEST(counter->getOutputValue<double>(s, "twice_time") == 2.0);
+    SimTK_TEST(counter->numCalls == 2);
+
+    // Once the State is realized through Dynamics, the value is memoized.
+    system.realize(s, Stage::Dynamics);
+    SimTK_TEST(counter->getOutputValue<double>(s, "twice_time") == 2.0);
+    SimTK_TEST(counter->getOutputValue<double>(s, "twice_time") == 2.0);
+    SimTK_TEST(counter->numCalls == 3);
+
+    // Changing the State invalidates the memoized value.
+    s.setTime(2.0);
+    system.realize(s, Stage::Dynamics);
+    SimTK_TEST(counter->getOutputValue<double>(s, "twice_time") == 4.0);
+    SimTK_TEST(counter->numCalls == 4);
+
+    // Each State holds its own value.
+    State s2 = s;
+    s2.setTime(3.0);
+    system.realize(s2, Stage::Dynamics);
+    SimTK_TEST(counter->getOutputValue<double>(s2, "twice_time") == 6.0);
+    SimTK_TEST(counter->getOutputValue<double>(s, "twice_time") == 4.0);
+    SimTK_TEST(counter->numCalls == 5);
+
+    // A Component that is not part of a System has nowhere to keep a value.
+    Counter orphan;
+    orphan.setName("orphan");
+    ASSERT_THROW(OpenSim::Exception,
+            orphan.getOutputValue<double>(s, "twice_time"));
+    SimTK_TEST(orphan.numCalls == 0);
+}
+
 void testInputConnecteeNames() {
     {
         std::string componentPath, outputName, channelName, alias;
@@ -2203,6 +2294,7 @@ int main() {
         SimTK_SUBTEST(testTraversePathToComponent);
         SimTK_SUBTEST(testGetStateVariableValue);
         SimTK_SUBTEST(testInputOutputConnections);
+        SimTK_SUBTEST(testOutputMemoization);
         SimTK_SUBTEST(testInputConnecteeNames);
         SimTK_SUBTEST(testExceptionsForConnecteeTypeMismatch);
         SimTK_SUBTEST(testExceptionsSocketNameExistsAlready);
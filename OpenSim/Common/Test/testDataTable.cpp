@@ -61,6 +61,10 @@ int main() {
 
         ASSERT(table.getColumnLabel(0) == "zero");
         ASSERT(table.getColumnLabel(2) == "two");
+        ASSERT(table.getColumnIndex("two") == 2);
+        ASSERT(!table.hasColumn("2"));
+        SimTK_TEST_MUST_THROW_EXC(table.getColumnIndex("2"),
+                                  OpenSim::KeyNotFound);
 
         table.setColumnLabel(0, "0");
         table.setColumnLabel(2, "2");
@@ -85,6 +89,8 @@ int main() {
 
     table.setDependentsMetaData(dep_metadata);
     table.setIndependentMetaData(ind_metadata);
+    ASSERT(table.getColumnIndex("5") == 4);
+    ASSERT(!table.hasColumn("0"));
 
     SimTK::RowVector_<double> row{5, double{0}};
 
@@ -208,6 +214,7 @@ int main() {
     table.removeDependentsMetaDataForKey("column-index");
     table.appendColumn("6", {0, 1, 2, 3, 4});
     table.appendColumn("7", std::vector<double>{0, 1, 2, 3, 4});
+    ASSERT(table.getColumnIndex("7") == 6);
 
     // ASSERT(table.getNumRows() == 5 && table.getNumColumns() == 7);
 
@@ -754,5 +761,57 @@ int main() {
                 TimestampLessThanEqualToPrevious);
     }
 
+    // Append many rows, with reserved capacity, interleaving reads.
+    {
+        TimeSeriesTable table{};
+        table.setColumnLabels({"a", "b", "c"});
+        table.reserveRows(1000);
+        for(unsigned r = 0; r < 1000; ++r) {
+            table.appendRow(0.01 * r, {1.0 * r, 2.0 * r, 3.0 * r});
+            if(r % 100 == 0) {
+                ASSERT(table.getNumRows() == r + 1);
+                ASSERT(table.getRowAtIndex(r)[2] == 3.0 * r);
+            }
+        }
+        ASSERT(table.getNumRows()    == 1000);
+        ASSERT(table.getNumColumns() == 3);
+
+        const auto& matrix = table.getMatrix();
+        ASSERT(matrix.nrow() == 1000);
+        ASSERT(matrix.ncol() == 3);
+        for(int r = 0; r < 1000; ++r) {
+            ASSERT(matrix(r, 0) == 1.0 * r);
+            ASSERT(matrix(r, 1) == 2.0 * r);
+        }
+        ASSERT(table.getDependentColumn("c")[999] == 3.0 * 999);
+
+        // Copies include rows that have just been appended.
+        table.appendRow(10.0, {-1.0, -2.0, -3.0});
+        TimeSeriesTable copy{table};
+        ASSERT(copy.getNumRows() == 1001);
+        ASSERT(copy.getMatrix()(1000, 2) == -3.0);
+
+        // A copy's view refers to the copy's own data.
+        copy.updMatrix()(1000, 2) = 5.0;
+        ASSERT(copy.getRowAtIndex(1000)[2] == 5.0);
+        ASSERT(table.getRowAtIndex(1000)[2] == -3.0);
+        ASSERT(&copy.getMatrix() == &copy.updMatrix());
+
+        SimTK_TEST_MUST_THROW_EXC(table.appendRow(11.0, {1.0, 2.0}),
+                                  IncorrectNumColumns);
+
+        // Views cover only the rows in use, not the spare capacity.
+        table.removeRowAtIndex(0);
+        ASSERT(table.getNumRows() == 1000);
+        ASSERT(table.getMatrix().nrow() == 1000);
+        ASSERT(table.getDependentColumnAtIndex(0).size() == 1000);
+        ASSERT(table.getRowAtIndex(0)[1] == 2.0);
+        ASSERT(table.getRowAtIndex(999)[0] == -1.0);
+
+        table.shrinkToFit();
+        ASSERT(table.getNumRows() == 1000);
+        ASSERT(table.getRowAtIndex(999)[0] == -1.0);
+    }
+
     return 0;
 }
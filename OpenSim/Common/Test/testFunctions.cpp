@@ -21,12 +21,20 @@
  * limitations under the License.                                             *
  * -------------------------------------------------------------------------- */
 
+#include <OpenSim/Common/Constant.h>
+#include <OpenSim/Common/GCVSpline.h>
+#include <OpenSim/Common/LinearFunction.h>
+#include <OpenSim/Common/PiecewiseLinearFunction.h>
+#include <OpenSim/Common/PolynomialFunction.h>
+#include <OpenSim/Common/SimmSpline.h>
 #include <OpenSim/Common/Sine.h>
 #include <OpenSim/Common/SignalGenerator.h>
 #include <OpenSim/Common/Reporter.h>
 
 #include "ComponentsForTesting.h"
 
+#include <memory>
+
 using namespace OpenSim;
 using namespace SimTK;
 
@@ -74,9 +82,68 @@ void testSignalGenerator() {
     }
 }
 
+// The scalar and batched evaluations of a function of one argument must agree
+// with the evaluation of the SimTK::Function it creates.
+void checkScalarEvaluation(const Function& f) {
+    std::unique_ptr<SimTK::Function> simtkFunction(f.createSimTKFunction());
+    const double x[] = {-0.5, 0.0, 0.3, 1.0, 1.7, 2.0, 2.6};
+    const int n = sizeof(x)/sizeof(x[0]);
+    double values[n];
+    for (int order = 0; order <= 2; ++order) {
+        f.calcValues(x, values, n, order);
+        for (int i = 0; i < n; ++i) {
+            const SimTK::Vector arg(1, x[i]);
+            const double expected = order == 0
+                ? simtkFunction->calcValue(arg)
+                : simtkFunction->calcDerivative(
+                        SimTK::Array_<int>(order, 0), arg);
+            SimTK_TEST_EQ(f.calcDerivative(x[i], order), expected);
+            SimTK_TEST_EQ(values[i], expected);
+            if (order == 0) {
+                SimTK_TEST_EQ(f.calcValue(x[i]), expected);
+                SimTK_TEST_EQ(f.calcValue(arg), expected);
+            }
+        }
+    }
+}
+
+void testScalarEvaluation() {
+    const Constant constant(3.5);
+    for (double x : {-1.0, 0.0, 2.0}) {
+        SimTK_TEST_EQ(constant.calcValue(x), 3.5);
+        SimTK_TEST_EQ(constant.calcDerivative(x, 0), 3.5);
+        SimTK_TEST_EQ(constant.calcDerivative(x, 1), 0.0);
+    }
+
+    // Functions that create a native SimTK::Function.
+    checkScalarEvaluation(LinearFunction(2.0, -1.0));
+    checkScalarEvaluation(PolynomialFunction(SimTK::Vector(Vec4(1, -2, 0.5, 3))));
+    const double xData[] = {0.0, 0.4, 0.8, 1.2, 1.6, 2.0};
+    const double yData[] = {0.0, 0.3, 0.2, 0.7, 1.1, 0.9};
+    checkScalarEvaluation(GCVSpline(5, 6, xData, yData));
+
+    // Functions evaluated through a FunctionAdapter: check against a line,
+    // which both interpolate exactly, extrapolation included.
+    const double yLine[] = {1.0, 1.8, 2.6, 3.4, 4.2, 5.0};
+    SimmSpline spline(6, xData, yLine);
+    PiecewiseLinearFunction linear(6, xData, yLine);
+    for (const Function* f : {(const Function*)&spline,
+                              (const Function*)&linear}) {
+        for (double x : {-0.5, 0.0, 0.3, 1.0, 2.0, 2.6}) {
+            SimTK_TEST_EQ_TOL(f->calcValue(x), 2*x + 1, 1e-12);
+            SimTK_TEST_EQ_TOL(f->calcDerivative(x, 1), 2.0, 1e-12);
+            SimTK_TEST_EQ(f->calcValue(x), f->calcValue(SimTK::Vector(1, x)));
+            SimTK_TEST_EQ(f->calcDerivative(x, 1),
+                    f->calcDerivative(std::vector<int>(1, 0),
+                                      SimTK::Vector(1, x)));
+        }
+    }
+}
+
 int main() {
 
     SimTK_START_TEST("testSignalGenerator");
         SimTK_SUBTEST(testSignalGenerator);
+        SimTK_SUBTEST(testScalarEvaluation);
     SimTK_END_TEST();
 }
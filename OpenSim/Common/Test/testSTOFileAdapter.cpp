@@ -25,6 +25,7 @@
 #include <unordered_set>
 #include <fstream>
 #include <cstdio>
+#include <cstring>
 
 std::string getNextToken(std::istream& stream, 
                          const std::string& delims) {
@@ -222,6 +223,43 @@ void testReadingWriting() {
     }
 }
 
+void testParsingNumbers() {
+    using namespace OpenSim;
+
+    // Numbers in all the formats we may come across. Each must be read exactly
+    // as std::stod() would read it.
+    const std::vector<std::string> numbers{"0", "-0", "+1.5", "0.1", "-.25",
+        "3.", "1e5", "1E-5", "-2.5e+03", "1.7976931348623157e308",
+        "0.30000000000000004",
+        "123456789012345678901234567890", "9007199254740993",
+        "1.00000000000000000000001", "1e-30", "nan", "-inf"};
+
+    std::string fileName{"testSTOFileAdapter_numbers.sto"};
+    {
+        std::ofstream file{fileName};
+        file << "numbers\r\nnRows=" << numbers.size() << "\r\n"
+             << "nColumns=2\r\nendheader\r\n"
+             << "time\tvalue\r\n";
+        for(size_t i = 0; i < numbers.size(); ++i)
+            file << i << "\t" << numbers[i] << "\r\n\r\n";
+    }
+    auto table = STOFileAdapter::read(fileName);
+    std::remove(fileName.c_str());
+
+    SimTK_TEST(table.getNumRows() == numbers.size());
+    SimTK_TEST(table.getNumColumns() == 1);
+    const auto& column = table.getDependentColumnAtIndex(0);
+    for(size_t i = 0; i < numbers.size(); ++i) {
+        const double expected = std::stod(numbers[i]);
+        const double received = column[static_cast<int>(i)];
+        if(SimTK::isNaN(expected))
+            SimTK_TEST(SimTK::isNaN(received));
+        else
+            SimTK_TEST(std::memcmp(&expected, &received,
+                                   sizeof(double)) == 0);
+    }
+}
+
 int main() {
     using namespace OpenSim;
 
@@ -294,6 +332,10 @@ int main() {
               << std::endl;
     testReadingWriting<SimTK::SpatialVec>();
 
+    std::cout << "Testing parsing of numbers in various formats"
+              << std::endl;
+    testParsingNumbers();
+
     std::cout << "Testing exception for reading an empty file"
               << std::endl;
     std::string emptyFileName("testSTOFileAdapter_empty.sto");
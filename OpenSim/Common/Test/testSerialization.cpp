@@ -37,6 +37,7 @@
 #include "SimTKcommon.h"
 
 #include <iostream>
+#include <memory>
 #include <string>
 
 #include "SerializableObject.h"
@@ -169,6 +170,31 @@ static void testPropertyOutputHelper(const SimTK::Transform& val)
     cout << propertyTransform->toString() << endl;
 }
 
+// Copies of a simple property share its values until one of them is
+// modified.
+static void testSharedSimplePropertyValues()
+{
+    std::unique_ptr<Property<std::string>> original(
+        Property<std::string>::TypeHelper::create("strings", false));
+    original->appendValue("a");
+    original->appendValue("b");
+    std::unique_ptr<Property<std::string>> copy(original->clone());
+    ASSERT(&copy->getValue(1) == &original->getValue(1));
+    ASSERT(copy->equals(*original));
+    copy->updValue(1) = "c";
+    ASSERT(&copy->getValue(0) != &original->getValue(0));
+    ASSERT(original->getValue(1) == "b" && copy->getValue(1) == "c");
+    original->appendValue("d");
+    ASSERT(original->size() == 3 && copy->size() == 2);
+
+    // A reference obtained from updValue() may be written through after a
+    // copy is made, so such a copy must not share the values.
+    std::string& first = original->updValue(0);
+    std::unique_ptr<Property<std::string>> later(original->clone());
+    first = "z";
+    ASSERT(original->getValue(0) == "z" && later->getValue(0) == "a");
+}
+
 int main()
 {
     // Test simple stringstream functionality with SimTK::writeUnformatted
@@ -258,6 +284,8 @@ int main()
         ASSERT(valStr == ans[i]);
     }
     cout << endl;
+
+    testSharedSimplePropertyValues();
     
 
     try {
@@ -379,6 +407,56 @@ int main()
         ASSERT(loc == 1);
         int notFound = objWithListProp.getProperty_list_SerializableObject().findIndexForName("Third");
         ASSERT(notFound == -1);
+
+        // Large sets look up names with an index, which must follow
+        // appends, inserts, removals and renames.
+        ObjSet bigSet;
+        for (int i = 0; i < 40; ++i) {
+            SerializableObject* obj = new SerializableObject();
+            obj->setName("obj" + std::to_string(i));
+            bigSet.adoptAndAppend(obj);
+        }
+        ASSERT(bigSet.getIndex("obj0") == 0);
+        ASSERT(bigSet.getIndex("obj39") == 39);
+        ASSERT(bigSet.getIndex("no_such_object") == -1);
+        SerializableObject* obj40 = new SerializableObject();
+        obj40->setName("obj40");
+        bigSet.adoptAndAppend(obj40);
+        ASSERT(bigSet.getIndex("obj40") == 40);
+        bigSet.get("obj10").setName("renamed");
+        ASSERT(bigSet.getIndex("obj10") == -1);
+        ASSERT(bigSet.getIndex("renamed") == 10);
+        ASSERT(bigSet.contains("renamed") && !bigSet.contains("obj10"));
+        bigSet.remove(0);
+        ASSERT(bigSet.getIndex("obj0") == -1);
+        ASSERT(bigSet.getIndex("renamed") == 9);
+        SerializableObject* first = new SerializableObject();
+        first->setName("first");
+        bigSet.insert(0, first);
+        ASSERT(bigSet.getIndex("first") == 0);
+        ASSERT(bigSet.getIndex("obj39") == 39);
+        // With duplicate names, the search starts at the given index.
+        bigSet.get("obj20").setName("obj30");
+        ASSERT(bigSet.getIndex("obj30") == 20);
+        ASSERT(bigSet.getIndex("obj30", 21) == 30);
+        // Naming an object that had no name also updates the index.
+        SerializableObject* unnamed = new SerializableObject();
+        bigSet.adoptAndAppend(unnamed);
+        ASSERT(bigSet.getIndex("obj1") == 1);
+        unnamed->setName("late");
+        ASSERT(bigSet.getIndex("late") == bigSet.getSize() - 1);
+        // A copy of the set owns copies of the objects; renaming those
+        // updates the index of the copy only.
+        ObjSet bigSetCopy(bigSet);
+        ASSERT(bigSetCopy.getIndex("late") == bigSet.getSize() - 1);
+        bigSetCopy.get("late").setName("later");
+        ASSERT(bigSetCopy.getIndex("later") == bigSet.getSize() - 1);
+        ASSERT(bigSetCopy.getIndex("late") == -1);
+        ASSERT(bigSet.getIndex("late") == bigSet.getSize() - 1);
+        // Assigning an object may rename it.
+        bigSet.get("first") = bigSet.get("obj39");
+        ASSERT(bigSet.getIndex("first") == -1);
+        ASSERT(bigSet.getIndex("obj39") == 0);
     }
     catch(const std::exception& e) {
         cerr << "EXCEPTION: " << e.what() << endl;
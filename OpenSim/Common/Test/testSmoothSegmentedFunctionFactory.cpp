@@ -1132,6 +1132,84 @@ void testMonotonicity(SimTK::Matrix mcfSample)
     cout << endl;
 }
 
+/*
+ 5. The lookup table of a curve is tested: the tabulated values and first two
+    derivatives must match the exact curve to the requested tolerance over 
+    the domain and in the linearly extrapolated regions, and calcValues() 
+    must agree with calcDerivative().
+*/
+void testLookupTable(SmoothSegmentedFunction mcf)
+{
+    cout << "   TEST: Lookup Table " << endl;
+    double tol = 1e-9;
+
+    SimTK::Vec2 domain = mcf.getCurveDomain();
+    double width = domain(1)-domain(0);
+    int n = 1001;
+    std::vector<double> x(n), exact(n), tabulated(n), batch(n);
+    for(int i=0; i<n; i++){
+        x[i] = domain(0) - 0.25*width + 1.5*width*((double)i)/(n-1);
+    }
+
+    SmoothSegmentedFunction exactCurve = mcf;
+    SimTK_TEST(!mcf.isLookupTableAvailable());
+    mcf.buildLookupTable(tol);
+    SimTK_TEST(mcf.isLookupTableAvailable());
+    SimTK_TEST(!exactCurve.isLookupTableAvailable());
+
+    for(int order=0; order<=2; order++){
+        exactCurve.calcValues(&x[0], &exact[0], n, order);
+        mcf.calcValues(&x[0], &batch[0], n, order);
+        for(int i=0; i<n; i++){
+            tabulated[i] = order == 0 ? mcf.calcValue(x[i]) 
+                                      : mcf.calcDerivative(x[i],order);
+            SimTK_TEST_EQ_TOL(batch[i], tabulated[i], 0);
+            //The table is refined using a few samples per interval, so 
+            //allow some slack between the samples
+            SimTK_TEST_EQ_TOL(tabulated[i], exact[i], 
+                              10*tol*(1+abs(exact[i])));
+        }
+    }
+
+    //Derivatives above the 2nd are not tabulated
+    exactCurve.calcValues(&x[0], &exact[0], n, 3);
+    mcf.calcValues(&x[0], &batch[0], n, 3);
+    for(int i=0; i<n; i++){
+        SimTK_TEST_EQ_TOL(batch[i], exact[i], 0);
+    }
+
+    //The output array may alias the input array
+    std::vector<double> inPlace(x);
+    mcf.calcValues(&inPlace[0], &inPlace[0], n, 0);
+    mcf.calcValues(&x[0], &batch[0], n, 0);
+    for(int i=0; i<n; i++){
+        SimTK_TEST_EQ_TOL(inPlace[i], batch[i], 0);
+    }
+
+    mcf.clearLookupTable();
+    SimTK_TEST(!mcf.isLookupTableAvailable());
+    SimTK_TEST_EQ_TOL(mcf.calcValue(x[n/2]), exactCurve.calcValue(x[n/2]), 0);
+
+    SimTK_TEST_MUST_THROW(mcf.buildLookupTable(0));
+    SimTK_TEST_MUST_THROW(mcf.buildLookupTable(-1e-9));
+    //Unreachable with the maximum number of intervals
+    SimTK_TEST_MUST_THROW(mcf.buildLookupTable(1e-30));
+    SimTK_TEST(!mcf.isLookupTableAvailable());
+
+    //The tolerance is kept with the table and survives copies
+    mcf.setLookupTableTolerance(tol);
+    SimTK_TEST(mcf.isLookupTableAvailable());
+    SmoothSegmentedFunction tabulatedCurve = mcf;
+    SimTK_TEST_EQ(tabulatedCurve.getLookupTableTolerance(), tol);
+    mcf.setLookupTableTolerance(0);
+    SimTK_TEST(!mcf.isLookupTableAvailable());
+    SimTK_TEST_EQ(mcf.getLookupTableTolerance(), 0.0);
+    SimTK_TEST_MUST_THROW(mcf.setLookupTableTolerance(-1e-9));
+
+    printf("   passed: lookup table matches the curve to %e\n", tol);
+    cout << endl;
+}
+
 //______________________________________________________________________________
 /**
  * Create a muscle bench marking system. The bench mark consists of a single muscle 
@@ -1219,6 +1297,8 @@ int main(int argc, char* argv[])
             testMuscleCurveC2Continuity(tendonCurve,tendonCurveSample);
         //4. Test for monotonicity where appropriate
             testMonotonicity(tendonCurveSample);
+        //5. Test the lookup table
+            testLookupTable(tendonCurve);
 
         //5. Testing Exceptions
             cout << endl;
@@ -1289,6 +1369,8 @@ int main(int argc, char* argv[])
         //4. Test for monotonicity where appropriate
 
             testMonotonicity(fiberFLCurveSample);
+        //5. Test the lookup table
+            testLookupTable(fiberFLCurve);
 
         //5. Testing Exceptions
             cout << endl;
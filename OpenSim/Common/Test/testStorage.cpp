@@ -22,6 +22,7 @@
 
 #include <fstream>
 #include <OpenSim/Common/Storage.h>
+#include <OpenSim/Common/Signal.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 
 using namespace OpenSim;
@@ -29,6 +30,7 @@ using namespace std;
 
 
 void testStorageLoadingFromFile(const std::string& fileName, const int ncols);
+void testStorageColumnOperations();
 
 void testStorageLegacy() {
     // Create a storage from a std file "std_storage.sto"
@@ -120,6 +122,7 @@ int main() {
         #endif
 
         SimTK_SUBTEST(testStorageLegacy);
+        SimTK_SUBTEST(testStorageColumnOperations);
     SimTK_END_TEST();
 }
 
@@ -139,3 +142,88 @@ void testStorageLoadingFromFile(const std::string& fileName, const int numCols)
 
     ASSERT(numCols == labels.size());
 }
+
+// The whole-table operations work on contiguous copies of the columns; verify
+// that they give the same results as processing each column on its own.
+void testStorageColumnOperations()
+{
+    const int nr = 200;
+    const int nc = 5;
+    const double dt = 0.01;
+    Storage storage;
+    Array<std::string> labels;
+    labels.append("time");
+    for (int j = 0; j < nc; ++j) labels.append("c" + std::to_string(j));
+    storage.setColumnLabels(labels);
+    for (int i = 0; i < nr; ++i) {
+        SimTK::Vector row(nc);
+        for (int j = 0; j < nc; ++j)
+            row[j] = sin((j + 1)*i*dt) + 0.1*cos(37.0*(j + 1)*i*dt);
+        storage.append(i*dt, row);
+    }
+    // A row with an extra column; only the shared columns are processed.
+    storage.getStateVector(3)->getData().append(42.0);
+
+    // Expected results, one column at a time.
+    std::vector<Array<double>> columns(nc);
+    std::vector<Array<double>> filtered(nc);
+    std::vector<Array<double>> padded(nc);
+    for (int j = 0; j < nc; ++j) {
+        storage.getDataColumn(j, columns[j]);
+        ASSERT(columns[j].getSize() == nr);
+        filtered[j].setSize(nr);
+        Signal::LowpassIIR(dt, 6.0, nr, &columns[j][0], &filtered[j][0]);
+        padded[j] = filtered[j];
+        Signal::Pad(nr/2, padded[j]);
+    }
+
+    storage.lowpassIIR(6.0);
+    ASSERT(storage.getSize() == nr);
+    ASSERT(storage.getStateVector(3)->getSize() == nc + 1);
+    ASSERT(storage.getStateVector(3)->getData()[nc] == 42.0);
+    for (int j = 0; j < nc; ++j) {
+        Array<double> column;
+        storage.getDataColumn(j, column);
+        for (int i = 0; i < nr; ++i)
+            ASSERT_EQUAL(filtered[j][i], column[i], 0.0);
+    }
+
+    storage.pad(nr/2);
+    ASSERT(storage.getSize() == 2*nr);
+    ASSERT_EQUAL(-(nr/2)*dt, storage.getFirstTime(), 1e-12);
+    for (int j = 0; j < nc; ++j) {
+        Array<double> column;
+        storage.getDataColumn(j, column);
+        ASSERT(column.getSize() == padded[j].getSize());
+        for (int i = 0; i < column.getSize(); ++i)
+            ASSERT_EQUAL(padded[j][i], column[i], 0.0);
+    }
+
+    storage.multiplyColumn(1, -2.0);
+    Array<double> scaled;
+    storage.getDataColumn(1, scaled);
+    ASSERT_EQUAL(-2.0*padded[1][7], scaled[7], 0.0);
+
+    // Rows are interpolated at new times only; existing times, and times
+    // requested twice, are not duplicated.
+    Storage coarse;
+    coarse.setColumnLabels(labels);
+    for (int i = 0; i < 5; ++i)
+        coarse.append(i, SimTK::Vector(nc, 10.0*i));
+    Array<double> targets;
+    targets.append(2.5);
+    targets.append(0.5);
+    targets.append(3.0);
+    targets.append(2.5 + 1e-9);
+    targets.append(0.25);
+    coarse.interpolateAt(targets);
+    ASSERT(coarse.getSize() == 8);
+    const double expectedTimes[] = { 0, 0.25, 0.5, 1, 2, 2.5, 3, 4 };
+    for (int i = 0; i < coarse.getSize(); ++i) {
+        const StateVector& row = *coarse.getStateVector(i);
+        ASSERT_EQUAL(expectedTimes[i], row.getTime(), 1e-12);
+        ASSERT(row.getSize() == nc);
+        for (int j = 0; j < nc; ++j)
+            ASSERT_EQUAL(10.0*expectedTimes[i], row.getData()[j], 1e-12);
+    }
+}
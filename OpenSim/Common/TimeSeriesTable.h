@@ -163,6 +163,7 @@ public:
             // wipe out the data loaded if any
             this->_indData.clear();
             this->_depData.clear();
+            this->updateMatrixView();
             this->removeDependentsMetaDataForKey("labels");
             throw;
         }
@@ -187,6 +188,7 @@ public:
             // wipe out the data loaded if any
             this->_indData.clear();
             this->_depData.clear(); // should be empty
+            this->updateMatrixView();
             this->removeDependentsMetaDataForKey("labels"); // should be empty
             throw;
         }
@@ -221,15 +221,11 @@ record(const SimTK::State& s)
 
     // MAKE SURE ALL QUANTITIES ARE VALID
     _model->getMultibodySystem().realize(s, SimTK::Stage::Velocity );
-    // Get state variable names and values in same order and use that to update map
-    Array<std::string> stateNames = _model->getStateVariableNames();
+    // Get state variable values in the order their names had at begin()
     SimTK::Vector rStateValues = _model->getStateVariableValues(s);
 
-    // update map between names and values, then pass it to expression evaluator
-    for(int i=0; i<stateNames.getSize(); i++){
-        _variables.find(stateNames[i])->second = rStateValues[i];
-    }
-    double value = Lepton::Parser::parse(_expressionStr).evaluate(_variables);
+    double value =
+        _expression.evaluate(rStateValues.getContiguousScalarData());
     StateVector nextRow{s.getTime(), {}};
      nextRow.getData().append(value);
     _resultStore.append(nextRow);
@@ -259,11 +255,13 @@ begin( const SimTK::State& s)
     constructColumnLabels();
     // RESET STORAGE
     _resultStore.reset(s.getTime());
-    // Populate list of names, initial values from s
+    // Compile the expression once, in terms of the state variables
     Array<std::string> stateNames = _model->getStateVariableNames();
+    std::vector<std::string> variables;
     for(int i=0; i< stateNames.getSize(); i++){
-        _variables.insert(pair<string, double>(stateNames[i], 0.0));
+        variables.push_back(stateNames[i]);
     }
+    _expression = BoundExpression(_expressionStr, variables);
     // RECORD
     int status = 0;
     if(_resultStore.getSize()<=0) {
@@ -27,8 +27,8 @@
 //=============================================================================
 // INCLUDES
 //=============================================================================
-#include <map>
 #include "OpenSim/OpenSim.h"
+#include "OpenSim/Simulation/Model/BoundExpression.h"
 #include "osimExpPluginDLL.h"
 
 
@@ -56,7 +56,9 @@ OpenSim_DECLARE_CONCRETE_OBJECT(SymbolicExpressionReporter, Analysis);
 // DATA
 //=============================================================================
 private:
-    std::map<std::string, double> _variables;
+    /** Expression compiled at begin(), in terms of the state variables in
+    the order of Model::getStateVariableNames(). */
+    BoundExpression _expression;
 
 
 protected:
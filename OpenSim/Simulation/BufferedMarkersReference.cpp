@@ -0,0 +1,180 @@
+/* -------------------------------------------------------------------------- *
+ *                   OpenSim:  BufferedMarkersReference.cpp                   *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "BufferedMarkersReference.h"
+
+#include <algorithm>
+
+using namespace SimTK;
+
+namespace OpenSim {
+
+namespace {
+// A table with the given column labels and no rows, from which the base
+// class takes the names of the markers.
+TimeSeriesTable_<Vec3> makeEmptyTable(const std::vector<std::string>& names)
+{
+    TimeSeriesTable_<Vec3> table;
+    table.setColumnLabels(names);
+    return table;
+}
+} // anonymous namespace
+
+BufferedMarkersReference::BufferedMarkersReference() : MarkersReference()
+{
+    allocateBuffer(1);
+}
+
+BufferedMarkersReference::BufferedMarkersReference(
+        const std::vector<std::string>& markerNames,
+        int capacity,
+        const Set<MarkerWeight>* markerWeightSet) :
+    MarkersReference(makeEmptyTable(markerNames), markerWeightSet)
+{
+    OPENSIM_THROW_IF(capacity < 1, Exception,
+        "Expected the capacity of the buffer to be at least 1, but got " +
+        std::to_string(capacity) + ".");
+    _numMarkers = static_cast<int>(markerNames.size());
+    allocateBuffer(capacity);
+}
+
+BufferedMarkersReference::BufferedMarkersReference(
+        const BufferedMarkersReference& source) : MarkersReference(source)
+{
+    copyBuffer(source);
+}
+
+BufferedMarkersReference&
+BufferedMarkersReference::operator=(const BufferedMarkersReference& source)
+{
+    if (&source != this) {
+        MarkersReference::operator=(source);
+        copyBuffer(source);
+    }
+    return *this;
+}
+
+void BufferedMarkersReference::allocateBuffer(int capacity)
+{
+    _capacity = capacity;
+    _head = 0;
+    _tail = 0;
+    _times.assign(capacity, SimTK::NaN);
+    _arrivalTimes.assign(capacity, Clock::time_point());
+    _values.assign(static_cast<size_t>(capacity)*_numMarkers, Vec3(NaN));
+    _currentValues.assign(_numMarkers, Vec3(NaN));
+}
+
+void BufferedMarkersReference::copyBuffer(
+        const BufferedMarkersReference& source)
+{
+    _capacity = source._capacity;
+    _numMarkers = source._numMarkers;
+    _head = source._head.load();
+    _tail = source._tail.load();
+    _numDroppedFrames = source._numDroppedFrames.load();
+    _times = source._times;
+    _arrivalTimes = source._arrivalTimes;
+    _values = source._values;
+    _currentTime = source._currentTime;
+    _currentValues = source._currentValues;
+}
+
+bool BufferedMarkersReference::putValues(double time,
+                                         const Array_<Vec3>& values)
+{
+    OPENSIM_THROW_IF_FRMOBJ(static_cast<int>(values.size()) != _numMarkers,
+        Exception, "Expected values for " + std::to_string(_numMarkers) +
+        " markers, but got " + std::to_string(values.size()) + ".");
+
+    const long long head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= _capacity) {
+        ++_numDroppedFrames;
+        return false;
+    }
+    const int slot = static_cast<int>(head % _capacity);
+    _times[slot] = time;
+    _arrivalTimes[slot] = Clock::now();
+    std::copy(values.begin(), values.end(),
+              _values.begin() + static_cast<size_t>(slot)*_numMarkers);
+    // Publish the frame to the consumer.
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+bool BufferedMarkersReference::getNextValuesAndTime(double& time,
+                                                    Array_<Vec3>& values)
+{
+    const long long tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire))
+        return false;
+
+    const int slot = static_cast<int>(tail % _capacity);
+    const auto first = _values.begin() + static_cast<size_t>(slot)*_numMarkers;
+    std::copy(first, first + _numMarkers, _currentValues.begin());
+    _currentTime = _times[slot];
+    // Release the slot to the producer.
+    _tail.store(tail + 1, std::memory_order_release);
+
+    time = _currentTime;
+    values = _currentValues;
+    return true;
+}
+
+int BufferedMarkersReference::discardFramesOlderThan(double maxAge)
+{
+    const auto now = Clock::now();
+    const long long head = _head.load(std::memory_order_acquire);
+    long long tail = _tail.load(std::memory_order_relaxed);
+    int numDiscarded = 0;
+    while (head - tail > 1) {
+        const int slot = static_cast<int>(tail % _capacity);
+        const std::chrono::duration<double> age = now - _arrivalTimes[slot];
+        if (age.count() <= maxAge)
+            break;
+        ++tail;
+        ++numDiscarded;
+    }
+    _tail.store(tail, std::memory_order_release);
+    return numDiscarded;
+}
+
+int BufferedMarkersReference::getNumFramesInBuffer() const
+{
+    return static_cast<int>(_head.load() - _tail.load());
+}
+
+double BufferedMarkersReference::getCurrentTime() const
+{
+    return _currentTime;
+}
+
+void BufferedMarkersReference::getValues(const SimTK::State& s,
+                                         Array_<Vec3>& values) const
+{
+    OPENSIM_THROW_IF_FRMOBJ(SimTK::isNaN(_currentTime), Exception,
+        "No frame has been taken out of the buffer; call "
+        "getNextValuesAndTime() first.");
+    values = _currentValues;
+}
+
+} // end of namespace OpenSim
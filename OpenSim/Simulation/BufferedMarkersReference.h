@@ -0,0 +1,147 @@
+#ifndef OPENSIM_BUFFERED_MARKERS_REFERENCE_H_
+#define OPENSIM_BUFFERED_MARKERS_REFERENCE_H_
+/* -------------------------------------------------------------------------- *
+ *                    OpenSim:  BufferedMarkersReference.h                    *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "MarkersReference.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * A MarkersReference whose marker observations arrive one frame at a time,
+ * e.g., from a motion capture system streaming live data, rather than from a
+ * file or table that is loaded up front.
+ *
+ * Frames are pushed into a fixed-size ring buffer with putValues() and taken
+ * out, oldest first, with getNextValuesAndTime(). The values of the frame
+ * that was taken out last are the ones returned by getValues(), whatever
+ * the time of the state, so that an InverseKinematicsSolver tracks the frames
+ * in the order in which they were taken out. One thread may push frames while
+ * another thread takes them out; the buffer is lock-free and no memory is
+ * allocated for each frame. If the buffer is full, putValues() drops the new
+ * frame. Marker locations must be expressed in the units of the model.
+ *
+ * See StreamingInverseKinematicsSolver for solving for the pose of a model
+ * for each frame as it arrives.
+ */
+class OSIMSIMULATION_API BufferedMarkersReference : public MarkersReference {
+    OpenSim_DECLARE_CONCRETE_OBJECT(BufferedMarkersReference,
+                                    MarkersReference);
+//=============================================================================
+// METHODS
+//=============================================================================
+public:
+    //--------------------------------------------------------------------------
+    // CONSTRUCTION
+    //--------------------------------------------------------------------------
+    BufferedMarkersReference();
+
+    /** Create a reference for the markers with the given names, whose values
+    will be given in this order to putValues(). The buffer holds at most
+    capacity frames. The marker weights are associated to markers by name. */
+    BufferedMarkersReference(const std::vector<std::string>& markerNames,
+                             int capacity,
+                             const Set<MarkerWeight>* markerWeightSet = nullptr);
+
+    /** Copy the markers, weights, and frames in the buffer. The buffer must
+    not be in use by another thread while it is copied. */
+    BufferedMarkersReference(const BufferedMarkersReference& source);
+    BufferedMarkersReference& operator=(const BufferedMarkersReference& source);
+
+    virtual ~BufferedMarkersReference() {}
+
+    //--------------------------------------------------------------------------
+    // Streaming Interface
+    //--------------------------------------------------------------------------
+    /** Add a frame of marker locations, in the order of the names given to
+    the constructor, at the end of the buffer. May be called from a thread
+    other than the one that takes the frames out. Marker locations that are
+    NaN are not tracked in this frame.
+    @returns false if the buffer was full and the frame was dropped. */
+    bool putValues(double time, const SimTK::Array_<SimTK::Vec3>& values);
+
+    /** Take the oldest frame out of the buffer, making it the frame returned
+    by getValues().
+    @returns false, leaving time and values untouched, if the buffer is
+             empty. */
+    bool getNextValuesAndTime(double& time,
+                              SimTK::Array_<SimTK::Vec3>& values);
+
+    /** Discard the frames that have been in the buffer for longer than
+    maxAge seconds (of wall-clock time), except for the newest frame.
+    @returns the number of frames that were discarded. */
+    int discardFramesOlderThan(double maxAge);
+
+    /** The number of frames that are waiting in the buffer. */
+    int getNumFramesInBuffer() const;
+    int getCapacity() const { return _capacity; }
+    /** The number of frames that putValues() dropped because the buffer was
+    full. */
+    int getNumDroppedFrames() const { return _numDroppedFrames.load(); }
+    /** The time of the frame that was last taken out of the buffer. */
+    double getCurrentTime() const;
+
+    //--------------------------------------------------------------------------
+    // Reference Interface
+    //--------------------------------------------------------------------------
+    /** Streamed values are valid at any time. */
+    SimTK::Vec2 getValidTimeRange() const override {
+        return SimTK::Vec2(-SimTK::Infinity, SimTK::Infinity);
+    }
+    /** Get the values of the frame that was last taken out of the buffer. */
+    void getValues(const SimTK::State& s,
+                   SimTK::Array_<SimTK::Vec3>& values) const override;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    void allocateBuffer(int capacity);
+    void copyBuffer(const BufferedMarkersReference& source);
+
+    int _capacity{0};
+    int _numMarkers{0};
+    // Frame k occupies slot k % _capacity. _head counts the frames that were
+    // put in, and _tail those that were taken out; the producer alone writes
+    // _head and the consumer alone writes _tail.
+    std::atomic<long long> _head{0};
+    std::atomic<long long> _tail{0};
+    std::atomic<int> _numDroppedFrames{0};
+    std::vector<double> _times;
+    std::vector<Clock::time_point> _arrivalTimes;
+    // Values of all markers of each slot, slot by slot.
+    std::vector<SimTK::Vec3> _values;
+
+    // The frame that was last taken out of the buffer.
+    double _currentTime{SimTK::NaN};
+    SimTK::Array_<SimTK::Vec3> _currentValues;
+//=============================================================================
+};  // END of class BufferedMarkersReference
+//=============================================================================
+} // namespace
+
+#endif // OPENSIM_BUFFERED_MARKERS_REFERENCE_H_
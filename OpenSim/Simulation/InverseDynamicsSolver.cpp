@@ -23,8 +23,13 @@
 
 #include "InverseDynamicsSolver.h"
 #include "Model/Model.h"
+#include "SimbodyEngine/Joint.h"
 #include <OpenSim/Common/FunctionSet.h>
 
+#include <exception>
+#include <memory>
+#include <thread>
+
 using namespace std;
 using namespace SimTK;
 
@@ -127,17 +132,145 @@ Vector InverseDynamicsSolver::solve(SimTK::State &s, const FunctionSet &Qs, doub
 /** Same as above but for a given time series */
 void InverseDynamicsSolver::solve(SimTK::State &s, const FunctionSet &Qs, const Array_<double> &times, Array_<Vector> &genForceTrajectory)
 {
-    int nq = getModel().getNumCoordinates();
+    Array_<Vector_<SpatialVec> > bodyForceTrajectory;
+    solve(s, Qs, times, genForceTrajectory, Array_<const Joint*>(),
+          bodyForceTrajectory);
+}
+
+/** Same as above, also computing the equivalent body forces of joints */
+void InverseDynamicsSolver::solve(SimTK::State &s, const FunctionSet &Qs,
+    const Array_<double> &times, Array_<Vector> &genForceTrajectory,
+    const Array_<const Joint*> &joints,
+    Array_<Vector_<SpatialVec> > &bodyForceTrajectory)
+{
+    const Model& model = getModel();
+    int nq = model.getNumCoordinates();
     int nt = times.size();
+    int nj = joints.size();
+
+    if(Qs.getSize() != nq){
+        throw Exception("InverseDynamicsSolver::solve invalid number of q functions.");
+    }
+
+    if( nq != model.getNumSpeeds()){
+        throw Exception("InverseDynamicsSolver::solve using FunctionSet, nq != nu not supported.");
+    }
+
+    // Evaluate each coordinate function and its derivatives for all times
+    // up front; the threads below then only set and realize states.
+    Array_<Vector> qs(nt, Vector(nq)), us(nt, Vector(nq)), udots(nt, Vector(nq));
+    Vector values;
+    for(int i=0; i<nq; i++){
+        Qs.evaluate(i, 0, times, values);
+        for(int k=0; k<nt; k++) qs[k][i] = values[k];
+        Qs.evaluate(i, 1, times, values);
+        for(int k=0; k<nt; k++) us[k][i] = values[k];
+        Qs.evaluate(i, 2, times, values);
+        for(int k=0; k<nt; k++) udots[k][i] = values[k];
+    }
 
     //Preallocate if not done already
     genForceTrajectory.resize(nt, Vector(nq));
-    
-    AnalysisSet& analysisSet = const_cast<AnalysisSet&>(getModel().getAnalysisSet());
-    //fill in results for each time
-    for(int i=0; i<nt; i++){ 
-        genForceTrajectory[i] = solve(s, Qs, times[i]);
-        analysisSet.step(s, i);
+    bodyForceTrajectory.resize(nt, Vector_<SpatialVec>(nj));
+
+    AnalysisSet& analysisSet = const_cast<AnalysisSet&>(model.getAnalysisSet());
+
+    int numThreads = _numberOfThreads;
+    if(numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    numThreads = std::max(1, std::min(numThreads, nt));
+
+    // Solve times [first, last) with the given model, state and joints,
+    // which belong to the model.
+    auto solveTimes = [&](const Model& m, SimTK::State& sm,
+                          const Array_<const Joint*>& js,
+                          int first, int last, bool stepAnalyses) {
+        const MultibodySystem& system = m.getMultibodySystem();
+        for(int k=first; k<last; k++){
+            sm.updTime() = times[k];
+            sm.updQ() = qs[k];
+            sm.updU() = us[k];
+            sm.updUDot() = udots[k];
+
+            // Realize to dynamics stage so that all model forces are computed
+            system.realize(sm, Stage::Dynamics);
+            system.getMatterSubsystem().calcResidualForceIgnoringConstraints(
+                sm, system.getMobilityForces(sm, Stage::Dynamics),
+                system.getRigidBodyForces(sm, Stage::Dynamics),
+                udots[k], genForceTrajectory[k]);
+
+            for(int j=0; j<nj; j++){
+                bodyForceTrajectory[k][j] =
+                    js[j]->calcEquivalentSpatialForce(sm, genForceTrajectory[k]);
+            }
+            if(stepAnalyses) analysisSet.step(sm, k);
+        }
+    };
+
+    if(numThreads == 1){
+        solveTimes(model, s, joints, 0, nt, true);
+        return;
+    }
+
+    // The calling thread solves the last range of times on s, so that s
+    // holds the last time as it does when solving serially. The copies of
+    // the model are made before any thread starts.
+    std::vector<std::unique_ptr<Model> > copies;
+    std::vector<SimTK::State*> copyStates;
+    std::vector<Array_<const Joint*> > copyJoints;
+    const ForceSet& forces = model.getForceSet();
+    for(int t=0; t<numThreads-1; t++){
+        copies.emplace_back(model.clone());
+        SimTK::State& sCopy = copies.back()->initSystem();
+        const ForceSet& copyForces = copies.back()->getForceSet();
+        for(int i=0; i<forces.getSize(); i++){
+            copyForces[i].setAppliesForce(sCopy, forces[i].appliesForce(s));
+        }
+        sCopy.updZ() = s.getZ();
+        copyStates.push_back(&sCopy);
+
+        Array_<const Joint*> js(nj);
+        for(int j=0; j<nj; j++){
+            js[j] = &copies.back()->getComponent<Joint>(
+                joints[j]->getAbsolutePathString());
+        }
+        copyJoints.push_back(js);
+    }
+
+    std::vector<std::exception_ptr> errors(numThreads);
+    auto work = [&](int t) {
+        try {
+            const int first = t*nt/numThreads;
+            const int last = (t+1)*nt/numThreads;
+            if(t == numThreads-1)
+                solveTimes(model, s, joints, first, last, false);
+            else
+                solveTimes(*copies[t], *copyStates[t], copyJoints[t],
+                           first, last, false);
+        } catch (...) {
+            errors[t] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> threads;
+    for(int t=0; t<numThreads-1; t++) threads.emplace_back(work, t);
+    work(numThreads-1);
+    for(auto& thread : threads) thread.join();
+    for(const auto& error : errors) {
+        if(error) std::rethrow_exception(error);
+    }
+
+    // Analyses see every time in order, with the state realized to
+    // dynamics as in the serial solve.
+    if(analysisSet.getSize() > 0){
+        const MultibodySystem& system = model.getMultibodySystem();
+        for(int k=0; k<nt; k++){
+            s.updTime() = times[k];
+            s.updQ() = qs[k];
+            s.updU() = us[k];
+            s.updUDot() = udots[k];
+            system.realize(s, Stage::Dynamics);
+            analysisSet.step(s, k);
+        }
     }
 }
 
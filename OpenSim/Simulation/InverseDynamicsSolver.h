@@ -29,6 +29,7 @@
 namespace OpenSim {
 
 class FunctionSet;
+class Joint;
 
 //=============================================================================
 //=============================================================================
@@ -58,6 +59,9 @@ OpenSim_DECLARE_CONCRETE_OBJECT(InverseDynamicsSolver, Solver);
 // MEMBER VARIABLES
 //=============================================================================
 protected:
+    /** Number of threads used to solve a trajectory (see
+    setNumberOfThreads()). */
+    int _numberOfThreads{1};
 
 //=============================================================================
 // METHODS
@@ -98,7 +102,30 @@ public:
     virtual void solve(SimTK::State& s, const FunctionSet& Qs, 
                  const SimTK::Array_<double>&  times,
                  SimTK::Array_<SimTK::Vector>& genForceTrajectory);
+
+    /** Same as above, and also compute, in the same sweep over the times,
+        the equivalent spatial force (see Joint::calcEquivalentSpatialForce())
+        of each of the given joints of the model. bodyForceTrajectory[i][j] is
+        the force of joints[j] at times[i].
+        All the coordinate functions are evaluated for all the times before
+        any time is solved, and the times are split among
+        getNumberOfThreads() threads. Threads other than the calling one
+        solve on copies of the model, whose forces are enabled as in s.
+        Analyses of the model are stepped in order on s, which holds the last
+        time on return. */
+    virtual void solve(SimTK::State& s, const FunctionSet& Qs,
+                 const SimTK::Array_<double>& times,
+                 SimTK::Array_<SimTK::Vector>& genForceTrajectory,
+                 const SimTK::Array_<const Joint*>& joints,
+                 SimTK::Array_<SimTK::Vector_<SimTK::SpatialVec> >&
+                        bodyForceTrajectory);
 #endif
+
+    /** %Set the number of threads used to solve a trajectory. The default
+        is 1; 0 uses as many threads as there are cores. */
+    void setNumberOfThreads(int numberOfThreads)
+    {   _numberOfThreads = numberOfThreads; }
+    int getNumberOfThreads() const { return _numberOfThreads; }
 //=============================================================================
 };  // END of class InverseDynamicsSolver
 //=============================================================================
@@ -0,0 +1,244 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  EnsembleManager.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "EnsembleManager.h"
+#include "Manager.h"
+#include <OpenSim/Common/XMLDocument.h>
+#include <OpenSim/Simulation/Model/Model.h>
+#include <OpenSim/Simulation/StatesTrajectory.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <thread>
+
+using namespace OpenSim;
+
+namespace {
+AbstractProperty& updOverriddenProperty(Model& model,
+        const EnsembleManager::PropertyOverride& o) {
+    Component& component = (o.componentPath.empty() || o.componentPath == "/")
+        ? model : model.updComponent(o.componentPath);
+    return component.updPropertyByName(o.propertyName);
+}
+} // anonymous namespace
+
+/** A copy of the model, and its default state, used by one thread. */
+struct EnsembleManager::Worker {
+    std::unique_ptr<Model> model;
+    SimTK::State defaultState;
+    /** True if the System was last built with property overrides, which have
+    since been undone, so it must be rebuilt before the next run. */
+    bool systemIsModified = false;
+};
+
+EnsembleManager::EnsembleManager(const Model& model) : _model(model.clone())
+{}
+
+EnsembleManager::~EnsembleManager() = default;
+
+int EnsembleManager::addRun(const SimTK::State& initialState)
+{
+    return addRun(std::vector<PropertyOverride>(), initialState);
+}
+
+int EnsembleManager::addRun(const std::vector<PropertyOverride>& overrides)
+{
+    _runs.emplace_back(new Run());
+    _runs.back()->overrides = overrides;
+    return getNumRuns() - 1;
+}
+
+int EnsembleManager::addRun(const std::vector<PropertyOverride>& overrides,
+                            const SimTK::State& initialState)
+{
+    int index = addRun(overrides);
+    _runs.back()->initialState.reset(new SimTK::State(initialState));
+    return index;
+}
+
+void EnsembleManager::clearRuns()
+{
+    _runs.clear();
+}
+
+void EnsembleManager::setNumThreads(int numThreads)
+{
+    OPENSIM_THROW_IF(numThreads < 0, Exception,
+        "Expected the number of threads to be non-negative, but got " +
+        std::to_string(numThreads) + ".");
+    _numThreads = numThreads;
+}
+
+void EnsembleManager::setIntegratorAccuracy(double accuracy)
+{
+    OPENSIM_THROW_IF(!(accuracy > 0), Exception,
+        "Expected the integrator accuracy to be positive, but got " +
+        std::to_string(accuracy) + ".");
+    _accuracy = accuracy;
+}
+
+void EnsembleManager::setReportingInterval(double interval)
+{
+    OPENSIM_THROW_IF(!(interval >= 0), Exception,
+        "Expected the reporting interval to be non-negative, but got " +
+        std::to_string(interval) + ".");
+    _reportingInterval = interval;
+}
+
+void EnsembleManager::checkRunIndex(int run) const
+{
+    OPENSIM_THROW_IF(run < 0 || run >= getNumRuns(), IndexOutOfRange,
+                     (size_t)std::max(run, 0), 0, (size_t)getNumRuns() - 1);
+    OPENSIM_THROW_IF(_runs[run]->table.getNumRows() == 0, Exception,
+        "Run " + std::to_string(run) + " has not been integrated; call "
+        "integrate() first.");
+}
+
+const TimeSeriesTable& EnsembleManager::getStatesTable(int run) const
+{
+    checkRunIndex(run);
+    return _runs[run]->table;
+}
+
+void EnsembleManager::performRun(Worker& worker, Run& run,
+                                 double finalTime) const
+{
+    Model& model = *worker.model;
+
+    // Apply the overrides, remembering the original value of each property.
+    std::vector<std::unique_ptr<AbstractProperty>> originals;
+    struct RestoreProperties {
+        Model& model;
+        const std::vector<PropertyOverride>& overrides;
+        std::vector<std::unique_ptr<AbstractProperty>>& originals;
+        ~RestoreProperties() {
+            for (int i = (int)originals.size() - 1; i >= 0; --i)
+                updOverriddenProperty(model, overrides[i]).assign(*originals[i]);
+        }
+    } restore{model, run.overrides, originals};
+
+    for (const auto& o : run.overrides) {
+        AbstractProperty& prop = updOverriddenProperty(model, o);
+        originals.emplace_back(prop.clone());
+        SimTK::Xml::Element parent("PropertyOverride");
+        parent.appendNode(SimTK::Xml::Element(o.propertyName, o.value));
+        prop.readFromXMLParentElement(parent,
+                                      XMLDocument::getLatestVersion());
+    }
+
+    if (!run.overrides.empty() || worker.systemIsModified) {
+        worker.defaultState = model.initSystem();
+        worker.systemIsModified = !run.overrides.empty();
+    }
+
+    SimTK::State state = worker.defaultState;
+    if (run.initialState) {
+        const SimTK::State& initial = *run.initialState;
+        OPENSIM_THROW_IF(initial.getNQ() != state.getNQ() ||
+                         initial.getNU() != state.getNU() ||
+                         initial.getNZ() != state.getNZ(), Exception,
+            "The initial state of the run does not have the same number of "
+            "state variables as the model.");
+        state.setTime(initial.getTime());
+        state.updQ() = initial.getQ();
+        state.updU() = initial.getU();
+        state.updZ() = initial.getZ();
+    }
+
+    StatesTrajectory states;
+    Manager manager(model);
+    manager.setWriteToStorage(false);
+    manager.setPerformAnalyses(false);
+    if (!SimTK::isNaN(_accuracy)) manager.getIntegrator().setAccuracy(_accuracy);
+    manager.initialize(state);
+    states.append(manager.getState());
+
+    const double initialTime = state.getTime();
+    int numIntervals = 1;
+    if (_reportingInterval > 0) {
+        numIntervals = std::max(1, (int)std::ceil(
+            (finalTime - initialTime)/_reportingInterval - SimTK::SignificantReal));
+    }
+    for (int i = 1; i <= numIntervals; ++i) {
+        const double t = (i == numIntervals) ? finalTime
+                       : initialTime + i*_reportingInterval;
+        states.append(manager.integrate(t));
+    }
+
+    // The table must be created while the overrides are in effect, and
+    // while the System that the states belong to still exists.
+    run.table = states.exportToTable(model);
+}
+
+void EnsembleManager::integrate(double finalTime)
+{
+    if (_runs.empty()) return;
+    for (int i = 0; i < getNumRuns(); ++i) {
+        const double initialTime = _runs[i]->initialState
+            ? _runs[i]->initialState->getTime() : 0;
+        OPENSIM_THROW_IF(finalTime < initialTime, Exception,
+            "The final time (" + std::to_string(finalTime) + ") is before "
+            "the initial time of run " + std::to_string(i) + " (" +
+            std::to_string(initialTime) + ").");
+        _runs[i]->table = TimeSeriesTable();
+    }
+
+    int numThreads = _numThreads;
+    if (numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, getNumRuns());
+
+    // The copies of the model are made, and their systems created, here
+    // before any thread starts.
+    std::vector<Worker> workers(numThreads);
+    for (auto& worker : workers) {
+        worker.model.reset(_model->clone());
+        worker.defaultState = worker.model->initSystem();
+    }
+
+    std::vector<std::exception_ptr> errors(getNumRuns());
+    std::atomic<int> nextRun(0);
+    auto work = [&](Worker& worker) {
+        for (int i = nextRun++; i < getNumRuns(); i = nextRun++) {
+            try {
+                performRun(worker, *_runs[i], finalTime);
+            } catch (...) {
+                errors[i] = std::current_exception();
+                _runs[i]->table = TimeSeriesTable();
+                // The System may not reflect the restored properties.
+                worker.systemIsModified = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int k = 1; k < numThreads; ++k)
+        threads.emplace_back(work, std::ref(workers[k]));
+    work(workers[0]);
+    for (auto& thread : threads) thread.join();
+
+    for (const auto& error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,169 @@
+#ifndef OPENSIM_ENSEMBLE_MANAGER_H_
+#define OPENSIM_ENSEMBLE_MANAGER_H_
+/* -------------------------------------------------------------------------- *
+ *                        OpenSim:  EnsembleManager.h                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Common/TimeSeriesTable.h>
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace OpenSim {
+
+class Model;
+
+/**
+ * A class that runs an ensemble of forward simulations of one model, such as
+ * the runs of a parameter sweep or of a Monte Carlo sensitivity study, on
+ * several threads.
+ *
+ * Each run starts either from the model's default state or from a given
+ * initial state, and may change some of the model's properties first. All
+ * runs are integrated to the same final time with a Manager (using its
+ * default integrator). The states of each run are recorded at a fixed
+ * reporting interval.
+ *
+ * The model is copied once per thread, and each copy (and its System) is
+ * reused for all the runs that thread performs. A run that overrides
+ * properties rebuilds the System of its copy with initSystem(), and the
+ * original property values are restored once the run is done. Threads take
+ * the next run that no thread has started, so threads that get short runs
+ * go on to take more of them.
+ *
+ * Example: simulating a pendulum released from 100 different angles
+ * @code
+ * EnsembleManager ensemble(model);
+ * SimTK::State state = model.initSystem();
+ * for (int i = 0; i < 100; ++i) {
+ *     model.getCoordinateSet()[0].setValue(state, 0.01*i);
+ *     ensemble.addRun(state);
+ * }
+ * ensemble.setReportingInterval(0.01);
+ * ensemble.integrate(1.0);
+ * const TimeSeriesTable& run42 = ensemble.getStatesTable(42);
+ * @endcode
+ *
+ * Example: sweeping the stiffness of a spring
+ * @code
+ * for (double k : {100., 200., 400.}) {
+ *     ensemble.addRun({{"/forceset/spring", "stiffness",
+ *                       std::to_string(k)}});
+ * }
+ * @endcode
+ */
+class OSIMSIMULATION_API EnsembleManager
+{
+public:
+    /** A new value for a property of a component of the model, to be used
+    for one run. The value is given as the text of the property's element in
+    a model file, e.g., "0.5" or "0 -9.81 0". */
+    struct PropertyOverride {
+        PropertyOverride(const std::string& componentPath,
+                         const std::string& propertyName,
+                         const std::string& value) :
+            componentPath(componentPath), propertyName(propertyName),
+            value(value) {}
+        /** Absolute path of the component in the model (e.g.,
+        "/forceset/soleus_r"); "/" refers to the model itself. */
+        std::string componentPath;
+        std::string propertyName;
+        std::string value;
+    };
+
+    /** Copy the model; the model that is passed in is not used after the
+    constructor returns. */
+    explicit EnsembleManager(const Model& model);
+    ~EnsembleManager();
+
+    EnsembleManager(const EnsembleManager&) = delete;
+    void operator=(const EnsembleManager&) = delete;
+
+    /** Add a run that starts from the time and state variable values (Q, U
+    and Z) of initialState, which must come from a System of the same model
+    (e.g., that of the model passed to the constructor).
+    @returns the index of the run. */
+    int addRun(const SimTK::State& initialState);
+    /** Add a run that starts from the default state of the model after the
+    given properties have been changed.
+    @returns the index of the run. */
+    int addRun(const std::vector<PropertyOverride>& overrides);
+    /** Add a run that changes the given properties and then starts from the
+    time and state variable values of initialState. The overrides must not
+    change the number of state variables.
+    @returns the index of the run. */
+    int addRun(const std::vector<PropertyOverride>& overrides,
+               const SimTK::State& initialState);
+    int getNumRuns() const { return (int)_runs.size(); }
+    /** Remove all runs and their results. */
+    void clearRuns();
+
+    /** %Set the number of threads used to integrate the runs. 0 (the
+    default) uses all available hardware threads. */
+    void setNumThreads(int numThreads);
+    int getNumThreads() const { return _numThreads; }
+    /** %Set the accuracy of the integrator used for every run. If not set,
+    the integrator's default accuracy is used. */
+    void setIntegratorAccuracy(double accuracy);
+    /** %Set the interval at which the states of each run are recorded. If
+    0 (the default), only the initial and final states are recorded. */
+    void setReportingInterval(double interval);
+    double getReportingInterval() const { return _reportingInterval; }
+
+    /** Integrate every run from its initial time to finalTime, replacing the
+    results of any previous call. If a run fails, the other runs are still
+    integrated, and then the exception of the failed run with the lowest
+    index is rethrown. */
+    void integrate(double finalTime);
+
+    /** The values of the state variables that were recorded for a run, with
+    a column for each state variable of the model, in the order of
+    Model::getStateVariableNames(). The results are tables rather than
+    states because the copies of the model that integrated the runs, and
+    their Systems, are destroyed before integrate() returns. To realize a
+    recorded state, copy a row into a State of your own model with
+    Model::setStateVariableValues(). */
+    const TimeSeriesTable& getStatesTable(int run) const;
+
+private:
+    struct Run {
+        std::vector<PropertyOverride> overrides;
+        std::unique_ptr<SimTK::State> initialState;
+        TimeSeriesTable table;
+    };
+    struct Worker;
+
+    void checkRunIndex(int run) const;
+    void performRun(Worker& worker, Run& run, double finalTime) const;
+
+    std::unique_ptr<Model> _model;
+    std::vector<std::unique_ptr<Run>> _runs;
+    int _numThreads = 0;
+    double _accuracy = SimTK::NaN;
+    double _reportingInterval = 0;
+
+};  // END of class EnsembleManager
+
+} // namespace OpenSim
+
+#endif // OPENSIM_ENSEMBLE_MANAGER_H_
@@ -203,7 +203,7 @@ MarkersReference::updateInternalWeights() const {
 
 int
 MarkersReference::getNumRefs() const {
-    return static_cast<int>(_markerTable.getNumColumns());
+    return static_cast<int>(_markerNames.size());
 }
 
 double
@@ -209,6 +209,16 @@ public:
     int getStorageInterval() const;
 #endif
     virtual ArrayPtrs<Storage>& getStorageList();
+    /**
+     * Whether the results recorded for a frame depend only on the state at
+     * that frame and not on any earlier frame. If so, a range of frames can
+     * be split into pieces that are analyzed independently, on copies of
+     * this analysis, and whose results are concatenated afterwards (see
+     * AnalyzeTool::run()). Analyses that return true must list all of their
+     * results in getStorageList() and must do no more in end() than record
+     * the last frame. The default is false.
+     */
+    virtual bool isFrameIndependent() const { return false; }
     void setPrintResultFiles(bool aToWrite) { _printResultFiles = aToWrite; }
     bool getPrintResultFiles() const { return _printResultFiles; }
 
@@ -0,0 +1,108 @@
+/* -------------------------------------------------------------------------- *
+ *                      OpenSim:  BoundExpression.cpp                         *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "BoundExpression.h"
+#include <OpenSim/Common/Exception.h>
+#include <lepton/CompiledExpression.h>
+#include <lepton/ParsedExpression.h>
+#include <lepton/Parser.h>
+
+#include <algorithm>
+#include <ostream>
+
+using namespace OpenSim;
+
+BoundExpression::BoundExpression() = default;
+
+BoundExpression::BoundExpression(const std::string& expression,
+                                 const std::vector<std::string>& variables)
+:   _expressionString(expression), _variables(variables),
+    _expression(new Lepton::CompiledExpression(
+        Lepton::Parser::parse(expression).optimize()
+            .createCompiledExpression()))
+{
+    for (const std::string& var : _expression->getVariables()) {
+        if (std::find(_variables.begin(), _variables.end(), var) ==
+                _variables.end()) {
+            std::string supported;
+            for (const std::string& name : _variables)
+                supported += (supported.empty() ? "" : ", ") + name;
+            OPENSIM_THROW(Exception, "Unknown variable '" + var +
+                "' in expression '" + expression +
+                "'; the supported variables are: " + supported + ".");
+        }
+    }
+    bindSlots();
+}
+
+// Lepton::CompiledExpression leaks its operations when assigned to, so
+// expressions are only ever copy constructed.
+BoundExpression::BoundExpression(const BoundExpression& other)
+:   _expressionString(other._expressionString), _variables(other._variables),
+    _expression(other._expression ?
+        new Lepton::CompiledExpression(*other._expression) : nullptr)
+{
+    bindSlots();
+}
+
+BoundExpression& BoundExpression::operator=(const BoundExpression& other)
+{
+    if (this != &other) {
+        BoundExpression copy(other);
+        _expressionString.swap(copy._expressionString);
+        _variables.swap(copy._variables);
+        _expression.swap(copy._expression);
+        _slots.swap(copy._slots);
+    }
+    return *this;
+}
+
+BoundExpression::~BoundExpression() = default;
+
+void BoundExpression::bindSlots()
+{
+    _slots.clear();
+    if (!_expression)
+        return;
+    const std::set<std::string>& used = _expression->getVariables();
+    for (int i = 0; i < (int)_variables.size(); ++i) {
+        if (used.count(_variables[i]))
+            _slots.push_back(std::make_pair(i,
+                &_expression->getVariableReference(_variables[i])));
+    }
+}
+
+double BoundExpression::evaluate(const double* values)
+{
+    if (!_expression)
+        return 0.0;
+    for (const auto& slot : _slots)
+        *slot.second = values[slot.first];
+    return _expression->evaluate();
+}
+
+namespace OpenSim {
+std::ostream& operator<<(std::ostream& o, const BoundExpression& expression)
+{
+    return o << expression._expressionString;
+}
+} // namespace OpenSim
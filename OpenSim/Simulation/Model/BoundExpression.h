@@ -0,0 +1,88 @@
+#ifndef OPENSIM_BOUND_EXPRESSION_H_
+#define OPENSIM_BOUND_EXPRESSION_H_
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  BoundExpression.h                          *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Simulation/osimSimulationDLL.h>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Lepton {
+class CompiledExpression;
+}
+
+namespace OpenSim {
+
+/** A compiled Lepton expression whose variables are passed by position
+rather than by name. The variables that the expression may use are listed,
+in order, when it is compiled, and evaluate() takes their values in the same
+order. No names are looked up while evaluating.
+
+Evaluating writes the values into the workspace of the compiled expression,
+so one %BoundExpression must not be evaluated by several threads at once.
+Copies have their own workspace. A Component that evaluates an expression
+from its const methods keeps a copy in a cache variable of the State (see,
+e.g., ExpressionBasedCoordinateForce), so that separate States can be
+evaluated concurrently. */
+class OSIMSIMULATION_API BoundExpression {
+public:
+    /** An empty expression, which evaluates to 0. */
+    BoundExpression();
+
+    /** Compile `expression`, which may use any of the given `variables`.
+    @throws Exception If the expression uses a variable that is not one of
+                      `variables`. */
+    BoundExpression(const std::string& expression,
+                    const std::vector<std::string>& variables);
+
+    BoundExpression(const BoundExpression& other);
+    BoundExpression& operator=(const BoundExpression& other);
+    ~BoundExpression();
+
+    /** Evaluate the expression. `values` holds the value of each of the
+    variables passed to the constructor, in the same order. */
+    double evaluate(const double* values);
+
+    /** The expression as it was passed to the constructor. */
+    const std::string& getExpression() const { return _expressionString; }
+
+    friend std::ostream& operator<<(std::ostream& o,
+                                    const BoundExpression& expression);
+
+private:
+    // Point the slots at the workspace of _expression.
+    void bindSlots();
+
+    std::string _expressionString;
+    std::vector<std::string> _variables;
+    std::unique_ptr<Lepton::CompiledExpression> _expression;
+    // Index in _variables and workspace slot of each variable that the
+    // expression uses.
+    std::vector<std::pair<int, double*> > _slots;
+};
+
+} // namespace OpenSim
+
+#endif // OPENSIM_BOUND_EXPRESSION_H_
@@ -28,6 +28,7 @@ using namespace std;
 
 void CMCActuatorSubsystemRep::setCompleteState(const SimTK::State& state) {
     _completeState = state;
+    invalidatePose();
 }
 const SimTK::State& CMCActuatorSubsystemRep::getCompleteState() const{
     return(_completeState);
@@ -45,7 +46,7 @@ void CMCActuatorSubsystemRep::setCoordinateCorrections(const double* aCorrection
     for(i=0;i<size;i++) {
          _qCorrections[i] = aCorrections[i];
     }
-  
+    invalidatePose();
 }
 
 void CMCActuatorSubsystemRep::setSpeedCorrections(const double* aCorrections) {
@@ -54,6 +55,7 @@ void CMCActuatorSubsystemRep::setSpeedCorrections(const double* aCorrections) {
     for(i=0;i<size;i++) {
          _uCorrections[i] = aCorrections[i];
     }
+    invalidatePose();
 }
   
 void CMCActuatorSubsystemRep::setCoordinateTrajectories(FunctionSet *aSet) {
@@ -70,6 +72,7 @@ void CMCActuatorSubsystemRep::setCoordinateTrajectories(FunctionSet *aSet) {
     }
 
     _qSet = aSet;
+    invalidatePose();
 }
 void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
     // ERROR CHECKING
@@ -85,12 +88,14 @@ void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
     }
 
     _uSet = aSet;
+    invalidatePose();
 }
    CMCActuatorSubsystemRep::CMCActuatorSubsystemRep(Model* model) 
        : SimTK::Subsystem::Guts( "CMCActuatorSubsystem", "2.0"),
        _model(model),
        _holdCoordinatesConstant(false),
        _holdTime(0.0),
+       _poseTime(SimTK::NaN),
        _qSet(NULL),
        _uSet(NULL) {
 
@@ -114,9 +119,11 @@ void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
   void CMCActuatorSubsystemRep::holdCoordinatesConstant( double t ) {
       _holdCoordinatesConstant = true;
       _holdTime = t;
+      invalidatePose();
   }
   void CMCActuatorSubsystemRep::releaseCoordinates() {
        _holdCoordinatesConstant = false;
+       invalidatePose();
   }
   Model*  CMCActuatorSubsystemRep::getModel() const {
        return( _model);
@@ -134,37 +141,48 @@ void CMCActuatorSubsystemRep::setSpeedTrajectories(FunctionSet *aSet) {
          t = s.getTime();
     }
 
-    _qSet->evaluate(_qWork,0,t);
-    if(_uSet!=NULL) {
-        _uSet->evaluate(_uWork,0,t);
-    } else {
-        _qSet->evaluate(_uWork,1,t);
-    }
-
     /* Hack to obtain a mutable state in a const method */
     State& mutableCompState = const_cast<SimTK::State&>(_completeState);
 
-    // Update the coordinate values to pose the model while computing muscle
-    // controls
-    const CoordinateSet& coords = _model->getCoordinateSet();
-    for (int i = 0; i < nq; ++i) {
-        // the last argument to setValue, a bool to enforce constraints,
-        // is false since values come from a _qSet of splined desired
-        // kinematics formed from formCompleteStorages, which enforces
-        // model constraints.
-        coords[i].setValue(mutableCompState, _qWork[i] + _qCorrections[i], false);
-        coords[i].setSpeedValue(mutableCompState, _uWork[i] + _uCorrections[i]);
+    // The integrator evaluates several stages of a step at the same time (and
+    // every stage at the same time while the coordinates are held constant).
+    // The pose depends only on the time and the corrections, so it is set,
+    // projected, and realized again only when one of them changed; otherwise
+    // only the actuator states below change and the position and velocity
+    // stages of the complete state stay valid.
+    if (!(t == _poseTime && mutableCompState.getTime() == t)) {
+        _qSet->evaluate(_qWork,0,t);
+        if(_uSet!=NULL) {
+            _uSet->evaluate(_uWork,0,t);
+        } else {
+            _qSet->evaluate(_uWork,1,t);
+        }
+
+        // Update the coordinate values to pose the model while computing
+        // muscle controls
+        const CoordinateSet& coords = _model->getCoordinateSet();
+        for (int i = 0; i < nq; ++i) {
+            // the last argument to setValue, a bool to enforce constraints,
+            // is false since values come from a _qSet of splined desired
+            // kinematics formed from formCompleteStorages, which enforces
+            // model constraints.
+            coords[i].setValue(mutableCompState,
+                               _qWork[i] + _qCorrections[i], false);
+            coords[i].setSpeedValue(mutableCompState,
+                                    _uWork[i] + _uCorrections[i]);
+        }
+        // project() to satisfy constraints perturbed by _q/_uCorrections
+        _model->getMultibodySystem().projectQ(mutableCompState,
+            getModel()->get_assembly_accuracy() / 10);
+        _model->getMultibodySystem().projectU(mutableCompState,
+            getModel()->get_assembly_accuracy() / 10);
+        mutableCompState.updTime() = t;
+        _poseTime = t;
     }
-    // project() to satisfy constraints perturbed by _q/_uCorrections
-    _model->getMultibodySystem().projectQ(mutableCompState,
-        getModel()->get_assembly_accuracy() / 10);
-    _model->getMultibodySystem().projectU(mutableCompState,
-        getModel()->get_assembly_accuracy() / 10);
 
     /* copy  muscle states computed from the actuator system to the muscle states
        for the complete system  then compute forces*/
     mutableCompState.updZ() = s.getZ();
-    mutableCompState.updTime() = t;
 
     _model->getMultibodySystem().realize(_completeState, SimTK::Stage::Acceleration);
 
@@ -88,6 +88,9 @@ class CMCActuatorSubsystemRep : public SimTK::Subsystem::Guts {
   
   void holdCoordinatesConstant( double t );
   void releaseCoordinates();
+  /** Force the next realization to pose the complete state again from the
+      trajectories and corrections. */
+  void invalidatePose() { _poseTime = SimTK::NaN; }
 
   SimTK::State  _completeState;
   Model*        _model;
@@ -98,6 +101,9 @@ class CMCActuatorSubsystemRep : public SimTK::Subsystem::Guts {
 
   mutable Array<double> _qWork;
   mutable Array<double> _uWork;
+  /** Time at which the complete state was last posed (NaN if it must be
+      posed again). */
+  mutable double _poseTime;
 
   /** Prescribed trajectories of the generalized coordinates. */
   FunctionSet *_qSet;
@@ -178,7 +178,7 @@ void ExpressionBasedBushingForce::setMxExpression(std::string expression)
     expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
                         expression.end() );
     set_Mx_expression(expression);
-    MxProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    compileExpression(0, expression);
 }
 
 /** Set the expression for the My function and create it's lepton program */
@@ -188,7 +188,7 @@ void ExpressionBasedBushingForce::setMyExpression(std::string expression)
     expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
                         expression.end() );
     set_My_expression(expression);
-    MyProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    compileExpression(1, expression);
 }
 
 /** Set the expression for the Mz function and create it's lepton program */
@@ -197,7 +197,7 @@ void ExpressionBasedBushingForce::setMzExpression(std::string expression)
     expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
                         expression.end() );
     set_Mz_expression(expression);
-    MzProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    compileExpression(2, expression);
 }
 
 /** Set the expression for the Fx function and create it's lepton program */
@@ -206,7 +206,7 @@ void ExpressionBasedBushingForce::setFxExpression(std::string expression)
     expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
                         expression.end() );
     set_Fx_expression(expression);
-    FxProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    compileExpression(3, expression);
 }
 
 /** Set the expression for the Fy function and create it's lepton program */
@@ -215,7 +215,7 @@ void ExpressionBasedBushingForce::setFyExpression(std::string expression)
     expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
                         expression.end() );
     set_Fy_expression(expression);
-    FyProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    compileExpression(4, expression);
 }
 
 /** Set the expression for the Fz function and create it's lepton program */
@@ -224,8 +224,45 @@ void ExpressionBasedBushingForce::setFzExpression(std::string expression)
     expression.erase( remove_if(expression.begin(), expression.end(), ::isspace), 
                         expression.end() );
     set_Fz_expression(expression);
-    FzProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    compileExpression(5, expression);
 }
+
+namespace {
+    // Names of the cache variables that hold each State's copies of the
+    // stiffness force expressions.
+    const std::string forceExpressionNames[6] =
+        { "Mx_expression", "My_expression", "Mz_expression",
+          "Fx_expression", "Fy_expression", "Fz_expression" };
+}
+
+void ExpressionBasedBushingForce::
+    compileExpression(int which, const std::string& expression)
+{
+    // The deflections in the order computeDeflection() returns them
+    _forceExprs[which] = BoundExpression(expression,
+        { "theta_x", "theta_y", "theta_z", "delta_x", "delta_y", "delta_z" });
+}
+
+void ExpressionBasedBushingForce::
+    extendAddToSystem(SimTK::MultibodySystem& system) const
+{
+    Super::extendAddToSystem(system);
+    // Evaluating writes into the expressions' workspaces, so every State
+    // gets copies of its own.
+    for (int i = 0; i < 6; ++i)
+        addCacheVariable(forceExpressionNames[i], _forceExprs[i],
+                         SimTK::Stage::Topology);
+}
+
+void ExpressionBasedBushingForce::
+    extendRealizeTopology(SimTK::State& state) const
+{
+    Super::extendRealizeTopology(state);
+    for (int i = 0; i < 6; ++i)
+        const_cast<Self*>(this)->_forceExprIndices[i] =
+            getCacheVariableIndex(forceExpressionNames[i]);
+}
+
 //=============================================================================
 // COMPUTATION
 //=============================================================================
@@ -239,21 +276,12 @@ SimTK::Vec6 ExpressionBasedBushingForce::
 
     Vec6 fk = Vec6(0.0);
 
-    std::map<std::string, double> deflectionVars;
-    deflectionVars["theta_x"] = dq[0];
-    deflectionVars["theta_y"] = dq[1];
-    deflectionVars["theta_z"] = dq[2];
-    deflectionVars["delta_x"] = dq[3];
-    deflectionVars["delta_y"] = dq[4];
-    deflectionVars["delta_z"] = dq[5];
-
-
-    fk[0] = MxProg.evaluate(deflectionVars);
-    fk[1] = MyProg.evaluate(deflectionVars);
-    fk[2] = MzProg.evaluate(deflectionVars);
-    fk[3] = FxProg.evaluate(deflectionVars);
-    fk[4] = FyProg.evaluate(deflectionVars);
-    fk[5] = FzProg.evaluate(deflectionVars);
+    for (int i = 0; i < 6; ++i) {
+        BoundExpression& forceExpr = Value<BoundExpression>::downcast(
+            getSystem().getDefaultSubsystem()
+                .updCacheEntry(s, _forceExprIndices[i])).upd();
+        fk[i] = forceExpr.evaluate(&dq[0]);
+    }
 
     return -fk;
 }
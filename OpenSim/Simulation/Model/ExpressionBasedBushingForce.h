@@ -27,6 +27,7 @@
 // INCLUDE
 #include "Force.h"
 #include <OpenSim/Simulation/Model/TwoFrameLinker.h>
+#include "BoundExpression.h"
 
 namespace OpenSim {
 
@@ -234,14 +235,23 @@ private:
     // Implement ModelComponent interface.
     //--------------------------------------------------------------------------
     void extendFinalizeFromProperties() override;
+    void extendAddToSystem(SimTK::MultibodySystem& system) const override;
+    void extendRealizeTopology(SimTK::State& state) const override;
 
     void setNull();
     void constructProperties();
 
     SimTK::Mat66 _dampingMatrix{ 0.0 };
 
-    // parser programs for efficiently evaluating the expressions
-    Lepton::ExpressionProgram MxProg, MyProg, MzProg, FxProg, FyProg, FzProg;
+    // Compile the expression of stiffness force component `which` (in the
+    // order Mx, My, Mz, Fx, Fy, Fz) in terms of the deflections.
+    void compileExpression(int which, const std::string& expression);
+
+    // compiled expressions of the stiffness forces in the order Mx, My, Mz,
+    // Fx, Fy, Fz; each State holds its own copies in cache variables, which
+    // are what get evaluated
+    BoundExpression _forceExprs[6];
+    SimTK::ResetOnCopy<SimTK::CacheEntryIndex> _forceExprIndices[6];
 
 //==============================================================================
 };  // END of class ExpressionBasedBushingForce
@@ -26,8 +26,6 @@
 //=============================================================================
 #include "ExpressionBasedCoordinateForce.h"
 #include <OpenSim/Simulation/Model/Model.h>
-#include <lepton/Parser.h>
-#include <lepton/ParsedExpression.h>
 
 using namespace OpenSim;
 using namespace std;
@@ -97,7 +95,7 @@ void ExpressionBasedCoordinateForce::extendConnectToModel(Model& aModel)
             remove_if(expression.begin(), expression.end(), ::isspace), 
                       expression.end() );
     
-    _forceProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    _forceExpr = BoundExpression(expression, {"q", "qdot"});
 
     // Look up the coordinate
     if (!_model->updCoordinateSet().contains(coordName)) {
@@ -118,6 +116,17 @@ void ExpressionBasedCoordinateForce::
 {
     Super::extendAddToSystem(system);    // Base class first.
     addCacheVariable<double>("force_magnitude", 0.0, SimTK::Stage::Velocity);
+    // Evaluating writes into the expression's workspace, so every State gets
+    // a copy of its own.
+    addCacheVariable("force_expression", _forceExpr, SimTK::Stage::Topology);
+}
+
+void ExpressionBasedCoordinateForce::
+    extendRealizeTopology(SimTK::State& state) const
+{
+    Super::extendRealizeTopology(state);
+    const_cast<Self*>(this)->_forceExprIndex =
+        getCacheVariableIndex("force_expression");
 }
 
 //=============================================================================
@@ -135,12 +144,11 @@ void ExpressionBasedCoordinateForce::computeForce(const SimTK::State& s,
 double ExpressionBasedCoordinateForce::calcExpressionForce(const SimTK::State& s ) const
 {
     using namespace SimTK;
-    double q = _coord->getValue(s);
-    double qdot = _coord->getSpeedValue(s);
-    std::map<std::string, double> forceVars;
-    forceVars["q"] = q;
-    forceVars["qdot"] = qdot;
-    double forceMag = _forceProg.evaluate(forceVars);
+    const double vars[2] = { _coord->getValue(s), _coord->getSpeedValue(s) };
+    BoundExpression& forceExpr = Value<BoundExpression>::downcast(
+        getSystem().getDefaultSubsystem().updCacheEntry(s, _forceExprIndex))
+        .upd();
+    double forceMag = forceExpr.evaluate(vars);
     setCacheVariableValue<double>(s, "force_magnitude", forceMag);
     return forceMag;
 }
@@ -26,8 +26,6 @@
 //=============================================================================
 #include "ExpressionBasedPointToPointForce.h"
 #include <OpenSim/Simulation/Model/Model.h>
-#include <lepton/Parser.h>
-#include <lepton/ParsedExpression.h>
 
 using namespace OpenSim;
 using namespace std;
@@ -130,7 +128,7 @@ void ExpressionBasedPointToPointForce::extendConnectToModel(Model& model)
             remove_if(expression.begin(), expression.end(), ::isspace), 
                       expression.end() );
     
-    _forceProg = Lepton::Parser::parse(expression).optimize().createProgram();
+    _forceExpr = BoundExpression(expression, {"d", "ddot"});
 }
 
 //=============================================================================
@@ -142,6 +140,9 @@ extendAddToSystem(SimTK::MultibodySystem& system) const
     Super::extendAddToSystem(system);    // Base class first.
 
     addCacheVariable<double>("force_magnitude", 0.0, SimTK::Stage::Velocity);
+    // Evaluating writes into the expression's workspace, so every State gets
+    // a copy of its own.
+    addCacheVariable("force_expression", _forceExpr, SimTK::Stage::Topology);
 
     // Beyond the const Component get access to underlying SimTK elements
     ExpressionBasedPointToPointForce* mutableThis =
@@ -152,6 +153,14 @@ extendAddToSystem(SimTK::MultibodySystem& system) const
     mutableThis->_b2 = _body2->getMobilizedBody();
 }
 
+void ExpressionBasedPointToPointForce::
+extendRealizeTopology(SimTK::State& state) const
+{
+    Super::extendRealizeTopology(state);
+    const_cast<Self*>(this)->_forceExprIndex =
+        getCacheVariableIndex("force_expression");
+}
+
 //=============================================================================
 // Computing
 //=============================================================================
@@ -180,11 +189,11 @@ void ExpressionBasedPointToPointForce::computeForce(const SimTK::State& s,
     //speed along the line connecting the two bodies
     const double ddot = dot(vRel, r_G)/d;
 
-    std::map<std::string, double> forceVars;
-    forceVars["d"] = d;
-    forceVars["ddot"] = ddot;
-
-    double forceMag = _forceProg.evaluate(forceVars);
+    const double vars[2] = { d, ddot };
+    BoundExpression& forceExpr = Value<BoundExpression>::downcast(
+        getSystem().getDefaultSubsystem().updCacheEntry(s, _forceExprIndex))
+        .upd();
+    double forceMag = forceExpr.evaluate(vars);
     setCacheVariableValue<double>(s, "force_magnitude", forceMag);
 
     const Vec3 f1_G = (forceMag/d) * r_G;
@@ -24,7 +24,7 @@
  * -------------------------------------------------------------------------- */
 
 #include "Force.h"
-#include <lepton/ExpressionProgram.h>
+#include "BoundExpression.h"
 
 namespace SimTK {
 class MobilizedBody;
@@ -164,13 +164,17 @@ protected:
     //-----------------------------------------------------------------------------
     void extendConnectToModel(Model& model) override;
     void extendAddToSystem(SimTK::MultibodySystem& system) const override;
+    void extendRealizeTopology(SimTK::State& state) const override;
 
 private:
     void setNull();
     void constructProperties();
 
-    // parser programs for efficiently evaluating the expressions
-    Lepton::ExpressionProgram _forceProg;
+    // compiled expression of the force in terms of d and ddot; each State
+    // holds its own copy in the "force_expression" cache variable, which is
+    // what gets evaluated
+    BoundExpression _forceExpr;
+    SimTK::ResetOnCopy<SimTK::CacheEntryIndex> _forceExprIndex;
 
     // Temporary solution until implemented with Sockets
     SimTK::ReferencePtr<const PhysicalFrame> _body1;
@@ -29,8 +29,11 @@
 #include "MovingPathPoint.h"
 #include "PointForceDirection.h"
 #include <OpenSim/Simulation/Wrap/PathWrap.h>
+#include <OpenSim/Simulation/SimbodyEngine/CoordinateCouplerConstraint.h>
 #include "Model.h"
 
+#include <map>
+
 //=============================================================================
 // STATICS
 //=============================================================================
@@ -68,6 +71,10 @@ void GeometryPath::extendConnectToModel(Model& aModel)
     // (i.e., the set of currently active points is numbered
     // 1, 2, 3, ...).
     namePathPoints(0);
+
+    // Topology may have changed; dependencies are recomputed when the path is
+    // added to the System.
+    _coordinateDependencies.reset();
 }
 
 //_____________________________________________________________________________
@@ -87,11 +94,19 @@ void GeometryPath::extendConnectToModel(Model& aModel)
     Array<AbstractPathPoint *> pathPrototype;
     addCacheVariable<Array<AbstractPathPoint *> >
         ("current_path", pathPrototype, SimTK::Stage::Position);
+    // Working storage for wrapping; never marked valid since it carries
+    // nothing from one computation to the next.
+    addCacheVariable<WrapScratch>("wrap_scratch", WrapScratch(),
+                                  SimTK::Stage::Position);
 
     // We consider this cache entry valid any time after it has been created
     // and first marked valid, and we won't ever invalidate it.
     addCacheVariable<SimTK::Vec3>("color", get_Appearance().get_color(), 
                                   SimTK::Stage::Topology);
+
+    // The model is fully connected by now, so the topology can be used to
+    // determine which coordinates this path can possibly depend on.
+    computeCoordinateDependencies();
 }
 
  void GeometryPath::extendInitStateFromProperties(SimTK::State& s) const
@@ -853,8 +868,11 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
     if (get_PathWrapSet().getSize() < 1)
         return;
 
-    WrapResult best_wrap;
-    Array<int> result, order;
+    WrapScratch& scratch = updCacheVariableValue<WrapScratch>(s, "wrap_scratch");
+    WrapResult& best_wrap = scratch.best;
+    WrapResult& wr = scratch.candidate;
+    Array<int>& result = scratch.result;
+    Array<int>& order = scratch.order;
 
     result.setSize(get_PathWrapSet().getSize());
     order.setSize(get_PathWrapSet().getSize());
@@ -957,7 +975,7 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
                         || (   path.get(pt1)->getWrapObject() 
                             != path.get(pt2)->getWrapObject()))
                     {
-                        WrapResult wr;
+                        wr.wrap_pts.setSize(0);
                         wr.startPoint = pt1;
                         wr.endPoint   = pt2;
 
@@ -1012,8 +1030,12 @@ applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path) const
                     // If wrapping did occur, copy wrap info into the PathStruct.
                     ws.updWrapPoint1().getWrapPath().setSize(0);
 
+                    // Copy element by element to reuse the wrap path's storage.
                     Array<SimTK::Vec3>& wrapPath = ws.updWrapPoint2().getWrapPath();
-                    wrapPath = best_wrap.wrap_pts;
+                    const int numWrapPoints = best_wrap.wrap_pts.getSize();
+                    wrapPath.setSize(numWrapPoints);
+                    for (int j = 0; j < numWrapPoints; j++)
+                        wrapPath[j] = best_wrap.wrap_pts[j];
 
                     // In OpenSim, all conversion to/from the wrap object's 
                     // reference frame will be performed inside 
@@ -1134,12 +1156,153 @@ calcLengthAfterPathComputation(const SimTK::State& s,
 double GeometryPath::
 computeMomentArm(const SimTK::State& s, const Coordinate& aCoord) const
 {
+    // The moment arm is structurally zero for coordinates that cannot move
+    // any of the frames the path is attached to.
+    if (!canDependOnCoordinate(aCoord))
+        return 0.0;
+
     if (!_maSolver)
         const_cast<Self*>(this)->_maSolver.reset(new MomentArmSolver(*_model));
 
     return _maSolver->solve(s, aCoord,  *this);
 }
 
+bool GeometryPath::canDependOnCoordinate(const Coordinate& aCoord) const
+{
+    if (!_coordinateDependencies)
+        return true;
+    return _coordinateDependencies->count(&aCoord) > 0;
+}
+
+//_____________________________________________________________________________
+/*
+ * Determine the set of coordinates that can change the length of this path
+ * from the topology of the model (joints, path points, wrap objects and
+ * coordinate coupler constraints). The result is conservative: coordinates
+ * that are not in the set have a structurally zero moment arm.
+ */
+void GeometryPath::computeCoordinateDependencies() const
+{
+    Self* mthis = const_cast<Self*>(this);
+    mthis->_coordinateDependencies.reset();
+
+    const Model& model = getModel();
+
+    // Constraints other than coordinate couplers (e.g. a patella welded or
+    // point-constrained to the tibia) can couple any mobilities, so do not
+    // attempt to exploit sparsity in their presence.
+    const ConstraintSet& constraints = model.getConstraintSet();
+    for (int i = 0; i < constraints.getSize(); ++i) {
+        if (!dynamic_cast<const CoordinateCouplerConstraint*>(&constraints[i]))
+            return;
+    }
+
+    // Build the tree of joints connecting the base frames of the model,
+    // rooted at ground, keeping the joint to the parent of each frame.
+    std::map<const Frame*, std::vector<const Joint*> > adjacent;
+    for (const Joint& joint : model.getComponentList<Joint>()) {
+        adjacent[&joint.getParentFrame().findBaseFrame()].push_back(&joint);
+        adjacent[&joint.getChildFrame().findBaseFrame()].push_back(&joint);
+    }
+
+    std::map<const Frame*, const Joint*> inboardJoint;
+    const Frame* ground = &model.getGround();
+    inboardJoint[ground] = nullptr;
+    std::vector<const Frame*> frontier{ ground };
+    while (!frontier.empty()) {
+        const Frame* frame = frontier.back();
+        frontier.pop_back();
+        for (const Joint* joint : adjacent[frame]) {
+            if (joint == inboardJoint[frame]) continue;
+            const Frame* parent = &joint->getParentFrame().findBaseFrame();
+            const Frame* other = (parent == frame) ?
+                &joint->getChildFrame().findBaseFrame() : parent;
+            // A frame reached twice means the joints form a closed loop,
+            // which is enforced by a constraint; be conservative.
+            if (inboardJoint.count(other)) return;
+            inboardJoint[other] = joint;
+            frontier.push_back(other);
+        }
+    }
+
+    // Collect the frames the path is attached to.
+    std::set<const Frame*> anchors;
+    std::set<const Coordinate*> dependencies;
+    const PathPointSet& points = get_PathPointSet();
+    for (int i = 0; i < points.getSize(); ++i) {
+        anchors.insert(&points[i].getParentFrame().findBaseFrame());
+        if (auto mpp = dynamic_cast<const MovingPathPoint*>(&points[i])) {
+            if (mpp->hasXCoordinate())
+                dependencies.insert(&mpp->getXCoordinate());
+            if (mpp->hasYCoordinate())
+                dependencies.insert(&mpp->getYCoordinate());
+            if (mpp->hasZCoordinate())
+                dependencies.insert(&mpp->getZCoordinate());
+        }
+        else if (auto cpp = dynamic_cast<const ConditionalPathPoint*>(&points[i])) {
+            if (cpp->hasCoordinate())
+                dependencies.insert(&cpp->getCoordinate());
+        }
+    }
+    const PathWrapSet& wraps = get_PathWrapSet();
+    for (int i = 0; i < wraps.getSize(); ++i) {
+        if (const WrapObject* wo = wraps[i].getWrapObject())
+            anchors.insert(&wo->getFrame().findBaseFrame());
+    }
+
+    // Joints between the root and every anchor move all of the anchors
+    // rigidly and cannot change the length; all other joints on the way
+    // from any anchor to the root can.
+    std::map<const Joint*, int> jointCount;
+    int nConnected = 0;
+    for (const Frame* anchor : anchors) {
+        if (!inboardJoint.count(anchor)) continue;
+        ++nConnected;
+        for (const Joint* joint = inboardJoint[anchor]; joint != nullptr; ) {
+            ++jointCount[joint];
+            const Frame* parent = &joint->getParentFrame().findBaseFrame();
+            const Frame* next = (inboardJoint[parent] == joint) ?
+                &joint->getChildFrame().findBaseFrame() : parent;
+            joint = inboardJoint[next];
+        }
+    }
+    // An anchor that is not connected to ground by joints (e.g., a free
+    // body) moves independently of everything else.
+    const bool allConnected = (nConnected == int(anchors.size()));
+    for (const auto& jc : jointCount) {
+        if (allConnected && jc.second == nConnected) continue;
+        for (int i = 0; i < jc.first->numCoordinates(); ++i)
+            dependencies.insert(&jc.first->get_coordinates(i));
+    }
+
+    // Coordinates coupled to any dependency also produce a moment arm, since
+    // moving them moves the dependent coordinate (and vice versa).
+    bool grew = true;
+    while (grew) {
+        grew = false;
+        for (int i = 0; i < constraints.getSize(); ++i) {
+            const auto& coupler =
+                static_cast<const CoordinateCouplerConstraint&>(constraints[i]);
+            Array<std::string> names = coupler.getIndependentCoordinateNames();
+            names.append(coupler.getDependentCoordinateName());
+            std::vector<const Coordinate*> coupled;
+            bool touches = false;
+            for (int j = 0; j < names.getSize(); ++j) {
+                if (!model.getCoordinateSet().contains(names[j])) continue;
+                const Coordinate* c = &model.getCoordinateSet().get(names[j]);
+                coupled.push_back(c);
+                touches = touches || dependencies.count(c);
+            }
+            if (!touches) continue;
+            for (const Coordinate* c : coupled)
+                grew = dependencies.insert(c).second || grew;
+        }
+    }
+
+    mthis->_coordinateDependencies.reset(
+        new std::set<const Coordinate*>(std::move(dependencies)));
+}
+
 void GeometryPath::extendFinalizeFromProperties()
 {
     Super::extendFinalizeFromProperties();
@@ -29,8 +29,11 @@
 #include "OpenSim/Simulation/Model/ModelComponent.h"
 #include "PathPointSet.h"
 #include <OpenSim/Simulation/Wrap/PathWrapSet.h>
+#include <OpenSim/Simulation/Wrap/WrapResult.h>
 #include <OpenSim/Simulation/MomentArmSolver.h>
 
+#include <set>
+
 
 #ifdef SWIG
     #ifdef OSIMSIMULATION_API
@@ -86,6 +89,28 @@ private:
     // but we cannot simply use a unique_ptr because we want the pointer to be
     // cleared on copy.
     SimTK::ResetOnCopy<std::unique_ptr<MomentArmSolver> > _maSolver;
+
+    // Coordinates that can change the length of this path, derived from the
+    // model topology when the path is added to the System. Until then (or
+    // after a copy) it is null and the path may depend on every coordinate.
+    SimTK::ResetOnCopy<std::unique_ptr<std::set<const Coordinate*> > >
+        _coordinateDependencies;
+
+    // Working storage for applyWrapObjects(), kept in the state cache so that
+    // wrapping does not allocate once the buffers have grown to fit the path.
+    struct WrapScratch {
+        WrapResult candidate;  // result for the segment being tried
+        WrapResult best;       // best result for the current wrap object
+        Array<int> result;     // outcome of each wrap object
+        Array<int> order;      // order in which the wrap objects are applied
+
+        friend std::ostream& operator<<(std::ostream& o,
+                                        const WrapScratch&) {
+            o << "GeometryPath::WrapScratch should not be serialized!"
+              << std::endl;
+            return o;
+        }
+    };
     
 //=============================================================================
 // METHODS
@@ -181,6 +206,17 @@ public:
     //--------------------------------------------------------------------------
     virtual double computeMomentArm(const SimTK::State& s, const Coordinate& aCoord) const;
 
+    /** Determine whether the length of this path can depend on the given
+    Coordinate. This is derived from the model topology when the path is added
+    to the System: the path depends on the coordinates of the joints between
+    the bodies its points and wrap objects are attached to, the coordinates
+    that drive its moving and conditional path points, and any coordinates
+    coupled to those by a CoordinateCouplerConstraint. If this returns false,
+    the moment arm of the path about aCoord is structurally zero. Before the
+    System has been built (or if the model has constraints other than
+    CoordinateCouplerConstraints) this conservatively returns true. */
+    bool canDependOnCoordinate(const Coordinate& aCoord) const;
+
     //--------------------------------------------------------------------------
     // SCALING
     //--------------------------------------------------------------------------
@@ -220,6 +256,7 @@ protected:
 private:
 
     void computePath(const SimTK::State& s ) const;
+    void computeCoordinateDependencies() const;
     void computeLengtheningSpeed(const SimTK::State& s) const;
     void applyWrapObjects(const SimTK::State& s, Array<AbstractPathPoint*>& path ) const;
     double calcPathLengthChange(const SimTK::State& s, const WrapObject& wo, 
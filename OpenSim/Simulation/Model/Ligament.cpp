@@ -239,7 +239,7 @@ void Ligament::computeForce(const SimTK::State& s,
     
     // evaluate normalized tendon force length curve
     force = getForceLengthCurve().calcValue(
-        SimTK::Vector(1, path.getLength(s)/restingLength))* pcsaForce;
+        path.getLength(s)/restingLength)* pcsaForce;
     setCacheVariableValue<double>(s, "tension", force);
 
     OpenSim::Array<PointForceDirection*> PFDs;
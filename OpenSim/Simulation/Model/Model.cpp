@@ -27,6 +27,7 @@
 //=============================================================================
 
 #include <OpenSim/Common/IO.h>
+#include <OpenSim/Common/ObjectSnapshot.h>
 #include <OpenSim/Common/XMLDocument.h>
 #include <OpenSim/Common/ScaleSet.h>
 #include <OpenSim/Common/Storage.h>
@@ -53,8 +54,13 @@
 #include "MarkerSet.h"
 #include "ProbeSet.h"
 
+#include <algorithm>
+#include <exception>
+#include <fstream>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <OpenSim/Simulation/AssemblySolver.h>
 
@@ -102,7 +108,12 @@ Model::Model(const string &aFileName) :
 {   
     constructProperties();
     setNull();
-    updateFromXMLDocument();
+    // A snapshot holds properties that were already updated to the latest
+    // format, so there is no XML to read.
+    if (ObjectSnapshot::isSnapshotFile(aFileName))
+        ObjectSnapshot::read(*this, aFileName);
+    else
+        updateFromXMLDocument();
 
     _fileName = aFileName;
     cout << "Loaded model " << getName() << " from file " << getInputFileName() << endl;
@@ -136,6 +147,25 @@ Model* Model::clone() const
     return clone;
 }
 
+void Model::printSnapshot(const std::string& fileName) const
+{
+    // A model loaded from a snapshot passes on the .osim file it came from.
+    std::string sourceFileName = getInputFileName();
+    if (ObjectSnapshot::isSnapshotFile(sourceFileName))
+        sourceFileName = ObjectSnapshot::getSourceFileName(sourceFileName);
+
+    OPENSIM_THROW_IF_FRMOBJ(!ifstream(sourceFileName).good(), Exception,
+        "Cannot find " + sourceFileName + ", the file this model was loaded "
+        "from. A snapshot can only be written for a model loaded from a "
+        "file.");
+
+    // The snapshot stands for the file, so it is made from the file as it
+    // is now rather than from this model, which may have been modified
+    // since it was loaded.
+    const Model source(sourceFileName);
+    ObjectSnapshot::write(source, fileName, sourceFileName);
+}
+
 //_____________________________________________________________________________
 /*
  * Override default implementation by object to intercept and fix the XML node
@@ -1092,36 +1122,112 @@ void Model::generateDecorations
     }
 }
 
-void Model::equilibrateMuscles(SimTK::State& state)
+void Model::equilibrateMuscles(SimTK::State& state, int numberOfThreads)
 {
-    getMultibodySystem().realize(state, Stage::Velocity);
+    OPENSIM_THROW_IF_FRMOBJ(numberOfThreads < 0, Exception,
+        "Expected the number of threads to be non-negative, but got " +
+        std::to_string(numberOfThreads) + ".");
 
-    bool failed = false;
-    string errorMsg = "";
-
-    auto muscles = getComponentList<Muscle>();
+    getMultibodySystem().realize(state, Stage::Velocity);
 
-    for (auto& muscle : muscles) {
-        if (muscle.appliesForce(state)){
-            try{
-                muscle.computeEquilibrium(state);
+    SimTK::Array_<const Muscle*> muscles;
+    for (const auto& muscle : getComponentList<Muscle>()) {
+        if (muscle.appliesForce(state))
+            muscles.push_back(&muscle);
+    }
+    const int numMuscles = static_cast<int>(muscles.size());
+
+    // The message of the exception thrown by each muscle that failed to
+    // equilibrate; empty for the muscles that succeeded.
+    std::vector<std::string> errors(numMuscles);
+
+    if (numberOfThreads == 0)
+        numberOfThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    // Starting a thread costs about as much as equilibrating a few muscles.
+    const int minMusclesPerThread = 8;
+    numberOfThreads = std::min(numberOfThreads,
+                               numMuscles / minMusclesPerThread);
+
+    if (numberOfThreads <= 1) {
+        for (int i = 0; i < numMuscles; ++i) {
+            try {
+                muscles[i]->computeEquilibrium(state);
             }
             catch (const std::exception& e) {
-                if(!failed){ // haven't failed to equilibrate other muscles yet
-                    errorMsg = e.what();
-                    failed = true;
-                }
-                // just because one muscle failed to equilibrate doesn't mean 
+                // just because one muscle failed to equilibrate doesn't mean
                 // it isn't still useful to have remaining muscles equilibrate
                 // in an analysis, for example, we might not be reporting about
                 // all muscles, so continue with the rest.
-                continue;
+                errors[i] = e.what();
             }
         }
     }
+    else {
+        // The equilibrium of each muscle depends only on its own path length,
+        // lengthening speed and activation. Compute the paths here, so that
+        // the copies of the state made by the threads below already contain
+        // them, and each thread only solves for the fiber states.
+        for (const Muscle* muscle : muscles) {
+            muscle->getLength(state);
+            muscle->getLengtheningSpeed(state);
+        }
 
-    if(failed) // Notify the caller of the failure to equilibrate 
-        throw Exception("Model::equilibrateMuscles() "+errorMsg, __FILE__, __LINE__);
+        // Each thread equilibrates a contiguous range of muscles in its own
+        // copy of the state.
+        std::vector<SimTK::State> copies(numberOfThreads);
+        std::vector<std::exception_ptr> threadErrors(numberOfThreads);
+        auto equilibrateRange = [&](int t) {
+            try {
+                copies[t] = state;
+                const int begin = t*numMuscles/numberOfThreads;
+                const int end = (t + 1)*numMuscles/numberOfThreads;
+                for (int i = begin; i < end; ++i) {
+                    try {
+                        muscles[i]->computeEquilibrium(copies[t]);
+                    }
+                    catch (const std::exception& e) {
+                        errors[i] = e.what();
+                    }
+                }
+            }
+            catch (...) {
+                threadErrors[t] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> threads;
+        for (int t = 1; t < numberOfThreads; ++t)
+            threads.emplace_back(equilibrateRange, t);
+        equilibrateRange(0);
+        for (auto& thread : threads)
+            thread.join();
+        for (const auto& error : threadErrors)
+            if (error) std::rethrow_exception(error);
+
+        // Copy the solution for each muscle back into the caller's state.
+        for (int t = 0; t < numberOfThreads; ++t) {
+            const int begin = t*numMuscles/numberOfThreads;
+            const int end = (t + 1)*numMuscles/numberOfThreads;
+            for (int i = begin; i < end; ++i) {
+                if (!errors[i].empty()) continue;
+                const Muscle& muscle = *muscles[i];
+                const Array<std::string> names =
+                    muscle.getStateVariableNames();
+                for (int k = 0; k < names.getSize(); ++k) {
+                    muscle.setStateVariableValue(state, names[k],
+                        muscle.getStateVariableValue(copies[t], names[k]));
+                }
+                muscle.setActuation(state, muscle.getActuation(copies[t]));
+            }
+        }
+    }
+
+    // Notify the caller of the first muscle that failed to equilibrate.
+    for (const auto& error : errors) {
+        if (!error.empty()) {
+            throw Exception("Model::equilibrateMuscles() " + error,
+                            __FILE__, __LINE__);
+        }
+    }
 }
 
 //=============================================================================
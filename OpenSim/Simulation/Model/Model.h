@@ -262,7 +262,9 @@ public:
     creating the System and initializing the State.
 
     @param filename     Name of a file containing an OpenSim model in XML
-                        format; suffix is typically ".osim". 
+                        format; suffix is typically ".osim". This can also be
+                        a binary snapshot written by printSnapshot(), which
+                        loads much faster.
     **/
     explicit Model(const std::string& filename) SWIG_DECLARE_EXCEPTION;
 
@@ -445,8 +447,20 @@ public:
 
     /**
      * Update the state of all Muscles so they are in equilibrium.
+     * The equilibrium of each muscle depends only on its own path and
+     * activation, so the muscles can be equilibrated with numberOfThreads
+     * threads, each working on its own copy of the state (0 means as many
+     * threads as the hardware supports). Few muscles are equilibrated on the
+     * calling thread regardless.
+     *
+     * The threads share this Model. Const methods of some components still
+     * write to mutable members of the component (e.g., to cache a result)
+     * rather than to the state, and those writes race when several threads
+     * evaluate the same component. Use more than one thread only for models
+     * whose muscles, and the components they evaluate, keep such results in
+     * the state. The tools (e.g., ForwardTool, CMCTool) use one thread.
      */
-    void equilibrateMuscles(SimTK::State& state);
+    void equilibrateMuscles(SimTK::State& state, int numberOfThreads = 1);
 
     //--------------------------------------------------------------------------
     /**@name       Access to the Simbody System and components
@@ -587,6 +601,18 @@ public:
      */
     void setInputFileName(const std::string& fileName) { _fileName = fileName; }
 
+    /**
+     * Write a binary snapshot of the .osim file from which this model was
+     * loaded (see getInputFileName()), which Model(fileName) can load
+     * without parsing and updating XML. The snapshot is made from a fresh
+     * load of that file, so changes made to this model since it was loaded
+     * are not included. It is tied to the content hash of the file, and
+     * loading it fails once the file changes. See ObjectSnapshot.
+     *
+     * @param fileName The name of the snapshot file to write.
+     */
+    void printSnapshot(const std::string& fileName) const;
+
     //--------------------------------------------------------------------------
     // CREDITS
     //--------------------------------------------------------------------------
@@ -217,28 +217,28 @@ SimTK::Vec3 MovingPathPoint::getLocation(const SimTK::State& s) const
         const double xval = SimTK::clamp(_xCoordinate->getRangeMin(),
             _xCoordinate->getValue(s),
             _xCoordinate->getRangeMax());
-        pInF[0] = get_x_location().calcValue(SimTK::Vector(1, xval));
+        pInF[0] = get_x_location().calcValue(xval);
     }
     else // assume a Constant
-        pInF[0] = get_x_location().calcValue(SimTK::Vector(1, 0.0));
+        pInF[0] = get_x_location().calcValue(0.0);
 
     if (!_yCoordinate.empty()) {
         const double yval = SimTK::clamp(_yCoordinate->getRangeMin(),
             _yCoordinate->getValue(s),
             _yCoordinate->getRangeMax());
-        pInF[1] = get_y_location().calcValue(SimTK::Vector(1, yval));
+        pInF[1] = get_y_location().calcValue(yval);
     }
     else // type == Constant
-        pInF[1] = get_y_location().calcValue(SimTK::Vector(1, 0.0));
+        pInF[1] = get_y_location().calcValue(0.0);
 
     if (!_zCoordinate.empty()) {
         const double zval = SimTK::clamp(_zCoordinate->getRangeMin(),
             _zCoordinate->getValue(s),
             _zCoordinate->getRangeMax());
-        pInF[2] = get_z_location().calcValue(SimTK::Vector(1, zval));
+        pInF[2] = get_z_location().calcValue(zval);
     }
     else // type == Constant
-        pInF[2] = get_z_location().calcValue(SimTK::Vector(1, 0.0));
+        pInF[2] = get_z_location().calcValue(0.0);
 
     return pInF;
 }
@@ -246,15 +246,11 @@ SimTK::Vec3 MovingPathPoint::getLocation(const SimTK::State& s) const
 
 SimTK::Vec3 MovingPathPoint::getVelocity(const SimTK::State& s) const
 {
-    std::vector<int> derivComponents;
-    derivComponents.push_back(0);
-
     SimTK::Vec3 vInF(0);
 
     if (!_xCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        vInF[0] = get_x_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _xCoordinate->getValue(s)))*
+        vInF[0] = get_x_location().calcDerivative(_xCoordinate->getValue(s), 1)*
                 _xCoordinate->getSpeedValue(s);
     }
     else
@@ -262,8 +258,7 @@ SimTK::Vec3 MovingPathPoint::getVelocity(const SimTK::State& s) const
 
     if (!_yCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        vInF[1] = get_y_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _yCoordinate->getValue(s)))*
+        vInF[1] = get_y_location().calcDerivative(_yCoordinate->getValue(s), 1)*
                 _yCoordinate->getSpeedValue(s);
     }
     else
@@ -271,8 +266,7 @@ SimTK::Vec3 MovingPathPoint::getVelocity(const SimTK::State& s) const
 
     if (!_zCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        vInF[2] = get_z_location().calcDerivative(
-            derivComponents, SimTK::Vector(1, _zCoordinate->getValue(s)))*
+        vInF[2] = get_z_location().calcDerivative(_zCoordinate->getValue(s), 1)*
                 _zCoordinate->getSpeedValue(s);
     }
     else
@@ -289,23 +283,17 @@ SimTK::Vec3 MovingPathPoint::getdPointdQ(const SimTK::State& s) const
 {
     SimTK::Vec3 dPdq_B(0);
 
-    std::vector<int> derivComponents;
-    derivComponents.push_back(0);
-
     if (!_xCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[0] = get_x_location().calcDerivative(derivComponents, 
-            SimTK::Vector(1, _xCoordinate->getValue(s)));
+        dPdq_B[0] = get_x_location().calcDerivative(_xCoordinate->getValue(s), 1);
     }
     if (!_yCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[1] = get_y_location().calcDerivative(derivComponents,
-            SimTK::Vector(1, _yCoordinate->getValue(s)));
+        dPdq_B[1] = get_y_location().calcDerivative(_yCoordinate->getValue(s), 1);
     }
     if (!_zCoordinate.empty()){
         //Multiply the partial (derivative of point coordinate w.r.t. gencoord) by genspeed
-        dPdq_B[2] = get_z_location().calcDerivative(derivComponents,
-            SimTK::Vector(1, _zCoordinate->getValue(s)));
+        dPdq_B[2] = get_z_location().calcDerivative(_zCoordinate->getValue(s), 1);
     }
 
     return dPdq_B;
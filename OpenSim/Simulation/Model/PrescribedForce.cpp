@@ -249,7 +249,6 @@ void PrescribedForce::computeForce(const SimTK::State& state,
     const FunctionSet& torqueFunctions = getTorqueFunctions();
 
     double time = state.getTime();
-    SimTK::Vector  timeAsVector(1, time);
 
     const bool hasForceFunctions  = forceFunctions.getSize()==3;
     const bool hasPointFunctions  = pointFunctions.getSize()==3;
@@ -259,18 +258,18 @@ void PrescribedForce::computeForce(const SimTK::State& state,
         getSocket<PhysicalFrame>("frame").getConnectee();
     const Ground& gnd = getModel().getGround();
     if (hasForceFunctions) {
-        Vec3 force(forceFunctions[0].calcValue(timeAsVector), 
-                   forceFunctions[1].calcValue(timeAsVector), 
-                   forceFunctions[2].calcValue(timeAsVector));
+        Vec3 force(forceFunctions[0].calcValue(time), 
+                   forceFunctions[1].calcValue(time), 
+                   forceFunctions[2].calcValue(time));
         if (!forceIsGlobal)
             force = frame.expressVectorInAnotherFrame(state, force, gnd);
 
         Vec3 point(0); // Default is body origin.
         if (hasPointFunctions) {
             // Apply force to a specified point on the body.
-            point = Vec3(pointFunctions[0].calcValue(timeAsVector), 
-                         pointFunctions[1].calcValue(timeAsVector), 
-                         pointFunctions[2].calcValue(timeAsVector));
+            point = Vec3(pointFunctions[0].calcValue(time), 
+                         pointFunctions[1].calcValue(time), 
+                         pointFunctions[2].calcValue(time));
             if (pointIsGlobal)
                 point = gnd.findStationLocationInAnotherFrame(state, point, frame);
 
@@ -278,9 +277,9 @@ void PrescribedForce::computeForce(const SimTK::State& state,
         applyForceToPoint(state, frame, point, force, bodyForces);
     }
     if (hasTorqueFunctions){
-        Vec3 torque(torqueFunctions[0].calcValue(timeAsVector), 
-                    torqueFunctions[1].calcValue(timeAsVector), 
-                    torqueFunctions[2].calcValue(timeAsVector));
+        Vec3 torque(torqueFunctions[0].calcValue(time), 
+                    torqueFunctions[1].calcValue(time), 
+                    torqueFunctions[2].calcValue(time));
         if (!forceIsGlobal)
             torque = frame.expressVectorInAnotherFrame(state, torque, gnd);
 
@@ -298,10 +297,9 @@ Vec3 PrescribedForce::getForceAtTime(double aTime) const
     if (forceFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 force(forceFunctions[0].calcValue(timeAsVector), 
-                     forceFunctions[1].calcValue(timeAsVector), 
-                     forceFunctions[2].calcValue(timeAsVector));
+    const Vec3 force(forceFunctions[0].calcValue(aTime), 
+                     forceFunctions[1].calcValue(aTime), 
+                     forceFunctions[2].calcValue(aTime));
     return force;
 }
 
@@ -312,10 +310,9 @@ Vec3 PrescribedForce::getPointAtTime(double aTime) const
     if (pointFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 point(pointFunctions[0].calcValue(timeAsVector), 
-                     pointFunctions[1].calcValue(timeAsVector), 
-                     pointFunctions[2].calcValue(timeAsVector));
+    const Vec3 point(pointFunctions[0].calcValue(aTime), 
+                     pointFunctions[1].calcValue(aTime), 
+                     pointFunctions[2].calcValue(aTime));
     return point;
 }
 
@@ -326,10 +323,9 @@ Vec3 PrescribedForce::getTorqueAtTime(double aTime) const
     if (torqueFunctions.getSize() != 3)
         return Vec3(0);
 
-    const SimTK::Vector timeAsVector(1, aTime);
-    const Vec3 torque(torqueFunctions[0].calcValue(timeAsVector), 
-                      torqueFunctions[1].calcValue(timeAsVector), 
-                      torqueFunctions[2].calcValue(timeAsVector));
+    const Vec3 torque(torqueFunctions[0].calcValue(aTime), 
+                      torqueFunctions[1].calcValue(aTime), 
+                      torqueFunctions[2].calcValue(aTime));
     return torque;
 }
 
@@ -389,8 +385,6 @@ OpenSim::Array<double> PrescribedForce::getRecordValues(const SimTK::State& stat
     const bool appliesTorque  = torqueFunctions.getSize()==3;
 
     // This is bad as it duplicates the code in computeForce we'll cleanup after it works!
-    const double time = state.getTime();
-    const SimTK::Vector timeAsVector(1, time);
     const PhysicalFrame& frame =
         getSocket<PhysicalFrame>("frame").getConnectee();
     const Ground& gnd = getModel().getGround();
@@ -24,6 +24,7 @@
 #include "MomentArmSolver.h"
 #include "Model/PointForceDirection.h"
 #include "Model/Model.h"
+#include "Model/GeometryPath.h"
 
 using namespace std;
 using namespace SimTK;
@@ -132,6 +133,77 @@ double MomentArmSolver::solve(const State &state, const Coordinate &aCoord,
     return ~_coupling*_generalizedForces;
 }
 
+SimTK::Matrix MomentArmSolver::solve(const State &state,
+                    const SimTK::Array_<const Coordinate*>& coordinates,
+                    const SimTK::Array_<const GeometryPath*>& paths) const
+{
+    const int nc = int(coordinates.size());
+    const int np = int(paths.size());
+    SimTK::Matrix ma(np, nc, 0.0);
+
+    //Local modifiable copy of the state
+    State& s_ma = _stateCopy;
+    s_ma.updQ() = state.getQ();
+
+    // only coordinates that can structurally influence at least one of the
+    // paths need to be considered at all
+    std::vector<bool> influential(nc, false);
+    for (int j = 0; j < nc; ++j) {
+        for (int i = 0; i < np && !influential[j]; ++i) {
+            influential[j] = paths[i]->canDependOnCoordinate(*coordinates[j]);
+        }
+    }
+
+    // compute the coupling between coordinates due to constraints, once per
+    // coordinate, and keep them as the columns of the coupling matrix
+    _couplingMatrix.resize(s_ma.getNU(), nc);
+    for (int j = 0; j < nc; ++j) {
+        if (influential[j])
+            _couplingMatrix(j) = computeCouplingVector(s_ma, *coordinates[j]);
+    }
+
+    // set speeds to zero; the path only depends on the positions
+    s_ma.updU() = 0;
+    getModel().getMultibodySystem().realize(s_ma, SimTK::Stage::Position);
+
+    _pathMobilityForces.resize(s_ma.getNU());
+
+    for (int i = 0; i < np; ++i) {
+        const GeometryPath& path = *paths[i];
+
+        bool dependsOnAny = false;
+        for (int j = 0; j < nc && !dependsOnAny; ++j) {
+            dependsOnAny = path.canDependOnCoordinate(*coordinates[j]);
+        }
+        // all moment-arms of this path are structurally zero
+        if (!dependsOnAny) continue;
+
+        // zero out all the forces
+        _bodyForces = SpatialVec(Vec3(0), Vec3(0));
+        _pathMobilityForces = 0;
+
+        // apply a tension of unity to the bodies of the path
+        path.addInEquivalentForces(s_ma, 1.0, _bodyForces, _pathMobilityForces);
+
+        // Convert body spatial forces F to equivalent mobility forces f based
+        // on geometry (no dynamics required): f = ~J(q) * F.
+        getModel().getMultibodySystem().getMatterSubsystem()
+            .multiplyBySystemJacobianTranspose(s_ma, _bodyForces,
+                                               _generalizedForces);
+
+        _generalizedForces += _pathMobilityForces;
+
+        // Moment-arm about each coordinate of interest is the effective
+        // torque (tension is 1) projected onto its coupling vector.
+        for (int j = 0; j < nc; ++j) {
+            if (path.canDependOnCoordinate(*coordinates[j]))
+                ma(i, j) = ~_couplingMatrix(j) * _generalizedForces;
+        }
+    }
+
+    return ma;
+}
+
 SimTK::Vector MomentArmSolver::computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const
 {
@@ -83,6 +83,24 @@ public:
     double solve(const SimTK::State& state, const Coordinate &coordinate, 
         const Array<PointForceDirection *> &pfds) const;
 
+    /** Solve for the effective moment-arms of a set of GeometryPaths about a
+        set of coordinates in a single pass. The constraint coupling vector of
+        each coordinate is computed once, and each path applies its unit
+        tension and is mapped to generalized forces once, so that the cost is
+        (ncoords + npaths) rather than (ncoords * npaths) solves. Moment-arms
+        that are structurally zero (see GeometryPath::canDependOnCoordinate())
+        are not computed.
+    @param  state               current state of the model
+    @param  coordinates         Coordinates about which we want moment-arms
+    @param  paths               GeometryPaths for which to calculate moment-arms
+    @return ma                  npaths x ncoords Matrix of moment-arms, where
+                                ma(i,j) is the moment-arm of paths[i] about
+                                coordinates[j]
+    */
+    SimTK::Matrix solve(const SimTK::State& state,
+        const SimTK::Array_<const Coordinate*>& coordinates,
+        const SimTK::Array_<const GeometryPath*>& paths) const;
+
 private:
     // Internal state of the solver initialized as a copy of the default state
     mutable SimTK::State _stateCopy;
@@ -96,6 +114,13 @@ private:
     // Keep preallocated vector of the coupling constraint factors
     mutable SimTK::Vector _coupling;
 
+    // Keep preallocated matrix of coupling factors (nu x ncoords), one column
+    // per coordinate, used by the batched solve
+    mutable SimTK::Matrix _couplingMatrix;
+
+    // Keep preallocated vector of path dependent mobility forces
+    mutable SimTK::Vector _pathMobilityForces;
+
     // compute vector of constraint coupling factors
     SimTK::Vector computeCouplingVector(SimTK::State &state, 
         const Coordinate &coordinate) const;
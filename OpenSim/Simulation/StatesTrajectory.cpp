@@ -140,6 +140,7 @@ TimeSeriesTable StatesTrajectory::exportToTable(const Model& model,
     size_t numDepColumns = stateVars.size();
     
     // Fill up the table with the data.
+    table.reserveRows(getSize());
     for (size_t itime = 0; itime < getSize(); ++itime) {
         const auto& state = get(itime);
         TimeSeriesTable::RowVector row(static_cast<int>(numDepColumns));
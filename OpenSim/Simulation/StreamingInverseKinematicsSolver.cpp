@@ -0,0 +1,80 @@
+/* -------------------------------------------------------------------------- *
+ *              OpenSim:  StreamingInverseKinematicsSolver.cpp                *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "StreamingInverseKinematicsSolver.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace OpenSim;
+
+StreamingInverseKinematicsSolver::StreamingInverseKinematicsSolver(
+        const Model& model,
+        BufferedMarkersReference& markersReference,
+        SimTK::Array_<CoordinateReference>& coordinateReferences,
+        double constraintWeight) :
+    _markersReference(markersReference),
+    _solver(model, markersReference, coordinateReferences, constraintWeight)
+{}
+
+void StreamingInverseKinematicsSolver::setAccuracy(double accuracy)
+{
+    _solver.setAccuracy(accuracy);
+    // The solver must assemble again before it can track.
+    _isAssembled = false;
+}
+
+void StreamingInverseKinematicsSolver::setLatencyBudget(double budget)
+{
+    OPENSIM_THROW_IF(!(budget >= 0), Exception,
+        "Expected the latency budget to be non-negative, but got " +
+        std::to_string(budget) + ".");
+    _latencyBudget = budget;
+}
+
+bool StreamingInverseKinematicsSolver::solveNextFrame(SimTK::State& s)
+{
+    if (_latencyBudget < SimTK::Infinity) {
+        _numFramesSkipped +=
+            _markersReference.discardFramesOlderThan(_latencyBudget);
+    }
+
+    double time;
+    if (!_markersReference.getNextValuesAndTime(time, _frameValues))
+        return false;
+
+    const auto start = std::chrono::steady_clock::now();
+    s.setTime(time);
+    if (_isAssembled) {
+        _solver.track(s);
+    } else {
+        _solver.assemble(s);
+        _isAssembled = true;
+    }
+    const std::chrono::duration<double> duration =
+        std::chrono::steady_clock::now() - start;
+
+    _lastSolveDuration = duration.count();
+    _maxSolveDuration = std::max(_maxSolveDuration, _lastSolveDuration);
+    ++_numFramesSolved;
+    return true;
+}
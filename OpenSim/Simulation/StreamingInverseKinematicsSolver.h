@@ -0,0 +1,120 @@
+#ifndef OPENSIM_STREAMING_INVERSE_KINEMATICS_SOLVER_H_
+#define OPENSIM_STREAMING_INVERSE_KINEMATICS_SOLVER_H_
+/* -------------------------------------------------------------------------- *
+ *               OpenSim:  StreamingInverseKinematicsSolver.h                 *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include "BufferedMarkersReference.h"
+#include "InverseKinematicsSolver.h"
+
+namespace OpenSim {
+
+//=============================================================================
+//=============================================================================
+/**
+ * Solve inverse kinematics for marker frames as they arrive, e.g., for live
+ * biofeedback. Frames are pushed into a BufferedMarkersReference (possibly
+ * from another thread, such as the one receiving data from a motion capture
+ * system), and each call to solveNextFrame() takes the oldest frame out of
+ * the buffer and solves for the pose that best matches it.
+ *
+ * The first frame is solved with InverseKinematicsSolver::assemble(), and
+ * every later frame with InverseKinematicsSolver::track(), starting from the
+ * pose of the previous frame that is in the state passed in. The accuracy of
+ * the solver bounds the work done for each frame.
+ *
+ * Under overload (frames arriving faster than they are solved), the latency
+ * budget limits how far behind the solver falls: frames that have waited in
+ * the buffer for longer than the budget are skipped, except for the newest
+ * frame. The time taken to solve each frame is recorded.
+ *
+ * @code
+ * BufferedMarkersReference markersRef(markerNames, 16);
+ * SimTK::Array_<CoordinateReference> coordinateRefs;
+ * StreamingInverseKinematicsSolver ik(model, markersRef, coordinateRefs);
+ * ik.setAccuracy(1e-4);
+ * ik.setLatencyBudget(0.01);
+ * // On the thread that receives the data:
+ * markersRef.putValues(time, markerLocations);
+ * // On the thread that solves:
+ * while (ik.solveNextFrame(state)) {
+ *     // state holds the pose for the frame at state.getTime().
+ * }
+ * @endcode
+ */
+class OSIMSIMULATION_API StreamingInverseKinematicsSolver
+{
+public:
+    /** The model and markersReference must outlive the solver. The system of
+    the model must have been created (with initSystem()). */
+    StreamingInverseKinematicsSolver(const Model& model,
+            BufferedMarkersReference& markersReference,
+            SimTK::Array_<CoordinateReference>& coordinateReferences,
+            double constraintWeight = SimTK::Infinity);
+
+    /** %Set the accuracy of the solution for each frame. Takes effect with
+    the next frame, which is solved with assemble(). */
+    void setAccuracy(double accuracy);
+    /** %Set the longest time (in seconds of wall-clock time) a frame may wait
+    in the buffer before it is skipped in favor of newer frames. The default
+    is Infinity: every frame is solved. */
+    void setLatencyBudget(double budget);
+    double getLatencyBudget() const { return _latencyBudget; }
+
+    /** Take the next frame that is within the latency budget out of the
+    buffer and solve for the pose that matches it. The time of s is set to the
+    time of the frame.
+    @returns false, leaving s untouched, if no frame is waiting. */
+    bool solveNextFrame(SimTK::State& s);
+
+    /** The time (in seconds of wall-clock time) it took to solve the last
+    frame. */
+    double getLastSolveDuration() const { return _lastSolveDuration; }
+    /** The longest time it took to solve a frame. */
+    double getMaxSolveDuration() const { return _maxSolveDuration; }
+    int getNumFramesSolved() const { return _numFramesSolved; }
+    /** The number of frames that were skipped because they exceeded the
+    latency budget. Frames dropped because the buffer was full are counted by
+    BufferedMarkersReference::getNumDroppedFrames(). */
+    int getNumFramesSkipped() const { return _numFramesSkipped; }
+
+    /** The underlying solver, e.g., to compute marker errors for the frame
+    that was solved last. */
+    const InverseKinematicsSolver& getSolver() const { return _solver; }
+    InverseKinematicsSolver& updSolver() { return _solver; }
+
+private:
+    BufferedMarkersReference& _markersReference;
+    InverseKinematicsSolver _solver;
+    bool _isAssembled{false};
+    double _latencyBudget{SimTK::Infinity};
+
+    double _lastSolveDuration{SimTK::NaN};
+    double _maxSolveDuration{0};
+    int _numFramesSolved{0};
+    int _numFramesSkipped{0};
+    SimTK::Array_<SimTK::Vec3> _frameValues;
+
+};  // END of class StreamingInverseKinematicsSolver
+
+} // namespace OpenSim
+
+#endif // OPENSIM_STREAMING_INVERSE_KINEMATICS_SOLVER_H_
@@ -38,6 +38,7 @@
 //
 //==============================================================================
 #include <ctime>  // clock(), clock_t, CLOCKS_PER_SEC
+#include <thread>
 #include <OpenSim/Simulation/osimSimulation.h>
 #include <OpenSim/Analyses/osimAnalyses.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
@@ -265,6 +266,42 @@ void testExpressionBasedCoordinateForce()
 
     osimModel.print("ExpressionBasedCoordinateForceModel.osim");
 
+    // A copy of the model evaluates its own compiled expression
+    auto modelCopy = std::unique_ptr<Model>{osimModel.clone()};
+    SimTK::State& copyState = modelCopy->initSystem();
+    const Coordinate& copyCoord = modelCopy->getCoordinateSet().get("ball_h");
+    copyCoord.setValue(copyState, 0.3);
+    copyCoord.setSpeedValue(copyState, -0.2);
+    modelCopy->realizeVelocity(copyState);
+    const ExpressionBasedCoordinateForce& copyOfForce =
+        dynamic_cast<const ExpressionBasedCoordinateForce&>(
+            modelCopy->getForceSet().get(0));
+    ASSERT_EQUAL(-10*0.3 - 5*(-0.2),
+                 copyOfForce.calcExpressionForce(copyState), 1e-12);
+
+    // Each State has its own copy of the compiled expression, so separate
+    // States can be evaluated concurrently
+    SimTK::State state1(copyState), state2(copyState);
+    copyCoord.setValue(state2, -0.4);
+    modelCopy->realizeVelocity(state2);
+    double force1 = 0, force2 = 0;
+    std::thread thread1([&] {
+        for (int i = 0; i < 1000; ++i)
+            force1 = copyOfForce.calcExpressionForce(state1);
+    });
+    std::thread thread2([&] {
+        for (int i = 0; i < 1000; ++i)
+            force2 = copyOfForce.calcExpressionForce(state2);
+    });
+    thread1.join();
+    thread2.join();
+    ASSERT_EQUAL(-10*0.3 - 5*(-0.2), force1, 1e-12);
+    ASSERT_EQUAL(-10*(-0.4) - 5*(-0.2), force2, 1e-12);
+
+    // Expressions can only depend on q and qdot
+    spring.setExpression("-10*q-5*x");
+    ASSERT_THROW(OpenSim::Exception, osimModel.initSystem());
+
     osimModel.disownAllComponents();
 }
 
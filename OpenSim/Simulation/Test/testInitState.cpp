@@ -42,6 +42,11 @@ void testStates(const string& modelFile);
 // cause the memory footprint of the process to increase significantly.
 //==============================================================================
 void testMemoryUsage(const string& modelFile);
+//==============================================================================
+// testParallelEquilibrium tests that equilibrating muscles with several threads
+// yields the same state as equilibrating them one at a time.
+//==============================================================================
+void testParallelEquilibrium(const string& modelFile);
 
 static const int MAX_N_TRIES = 100;
 
@@ -52,6 +57,7 @@ int main()
         testStates("arm26.osim");
         testMemoryUsage("arm26.osim");
         testMemoryUsage("PushUpToesOnGroundWithMuscles.osim");
+        testParallelEquilibrium("gait2354_simbody.osim");
     }
     catch (const Exception& e) {
         cout << "testInitState failed: ";
@@ -146,6 +152,43 @@ void testStates(const string& modelFile)
     ASSERT(max(abs(y1-y2)) > 1e-4);
 }
 
+void testParallelEquilibrium(const string& modelFile)
+{
+    using namespace SimTK;
+
+    Model model(modelFile);
+    State& state = model.initSystem();
+
+    // Pose the model away from its default pose so that the fiber lengths
+    // must change.
+    const CoordinateSet& coordinates = model.getCoordinateSet();
+    for (int i = 0; i < coordinates.getSize(); ++i) {
+        const Coordinate& coordinate = coordinates[i];
+        coordinate.setValue(state, 0.2*coordinate.getRangeMin() +
+                                   0.8*coordinate.getRangeMax(), false);
+    }
+    model.assemble(state);
+
+    State serial(state);
+    model.equilibrateMuscles(serial);
+    State parallel(state);
+    model.equilibrateMuscles(parallel, 4);
+
+    ASSERT(max(abs(serial.getY() - state.getY())) > 1e-6);
+    for (int i = 0; i < serial.getNY(); ++i) {
+        ASSERT_EQUAL(serial.getY()[i], parallel.getY()[i], 1e-12,
+            __FILE__, __LINE__,
+            "Parallel equilibration differs from serial equilibration.");
+    }
+    const auto& muscles = model.getMuscles();
+    for (int i = 0; i < muscles.getSize(); ++i) {
+        ASSERT_EQUAL(muscles[i].getActuation(serial),
+                     muscles[i].getActuation(parallel), 1e-9,
+                     __FILE__, __LINE__,
+                     "Tendon force of " + muscles[i].getName() + " differs.");
+    }
+}
+
 void testMemoryUsage(const string& modelFile)
 {
     using namespace SimTK;
@@ -32,6 +32,7 @@
 #include <OpenSim/Common/Constant.h>
 #include <OpenSim/Common/STOFileAdapter.h>
 #include <random>
+#include <thread>
 
 using namespace OpenSim;
 using namespace std;
@@ -71,6 +72,11 @@ void testTrackWithUpdateMarkerWeights();
 // includes intervals with NaNs (no observation)
 void testNumberOfMarkersMismatch();
 
+// Verify that frames streamed into a BufferedMarkersReference from another
+// thread are all solved, in order, and that frames are dropped when the
+// buffer is full and skipped when they exceed the latency budget.
+void testStreamingInverseKinematics();
+
 int main()
 {
     SimTK::Array_<std::string> failures;
@@ -101,6 +107,12 @@ int main()
         failures.push_back("testNumberOfMarkersMismatch");
     }
 
+    try { testStreamingInverseKinematics(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testStreamingInverseKinematics");
+    }
+
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
         return 1;
@@ -587,6 +599,104 @@ void testNumberOfMarkersMismatch()
     }
 }
 
+void testStreamingInverseKinematics()
+{
+    cout <<
+        "\ntestInverseKinematicsSolver::testStreamingInverseKinematics()"
+        << endl;
+    std::unique_ptr<Model> pendulum{ constructPendulumWithMarkers() };
+    Coordinate& coord = pendulum->getCoordinateSet()[0];
+
+    SimTK::State state = pendulum->initSystem();
+
+    StatesTrajectory states;
+    const int numFrames = 101;
+    const double dt = 0.01;
+    for (int i = 0; i < numFrames; ++i) {
+        state.updTime() = i*dt;
+        coord.setValue(state, SimTK::Pi/3*sin(SimTK::Pi*i*dt));
+        states.append(state);
+    }
+
+    SimTK::RowVector_<SimTK::Vec3> biases(3, SimTK::Vec3(0));
+    auto markerTable = generateMarkerDataFromModelAndStates(*pendulum,
+                                                            states, biases);
+    auto frameValues = [&](size_t i) {
+        const auto row = markerTable.getRowAtIndex(i);
+        SimTK::Array_<SimTK::Vec3> values;
+        for (int j = 0; j < row.ncol(); ++j)
+            values.push_back(row[j]);
+        return values;
+    };
+
+    // Stream all frames from another thread, with room for all of them.
+    BufferedMarkersReference markersRef(markerTable.getColumnLabels(),
+                                        numFrames);
+    SimTK::Array_<CoordinateReference> coordRefs;
+    coord.setValue(state, 0.0);
+    StreamingInverseKinematicsSolver ikSolver(*pendulum, markersRef,
+                                              coordRefs);
+    ikSolver.setAccuracy(1e-8);
+
+    std::thread producer([&]() {
+        for (int i = 0; i < numFrames; ++i)
+            markersRef.putValues(markerTable.getIndependentColumn()[i],
+                                 frameValues(i));
+    });
+    int numSolved = 0;
+    while (numSolved < numFrames) {
+        if (!ikSolver.solveNextFrame(state)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const SimTK::State& expected = states[numSolved];
+        SimTK_ASSERT_ALWAYS(state.getTime() == expected.getTime(),
+            "Streaming IK did not solve the frames in order.");
+        SimTK_ASSERT_ALWAYS(abs(coord.getValue(state) -
+                                coord.getValue(expected)) < 1e-6,
+            "Streaming IK failed to track the streamed markers.");
+        ++numSolved;
+    }
+    producer.join();
+    SimTK_ASSERT_ALWAYS(ikSolver.getNumFramesSolved() == numFrames &&
+                        ikSolver.getNumFramesSkipped() == 0 &&
+                        markersRef.getNumDroppedFrames() == 0,
+        "Streaming IK skipped or dropped frames without overload.");
+    SimTK_ASSERT_ALWAYS(ikSolver.getLastSolveDuration() >= 0 &&
+        ikSolver.getMaxSolveDuration() >= ikSolver.getLastSolveDuration(),
+        "Streaming IK did not report the time to solve the frames.");
+    SimTK_ASSERT_ALWAYS(!ikSolver.solveNextFrame(state),
+        "Streaming IK solved a frame that was not in the buffer.");
+
+    // A full buffer drops new frames.
+    BufferedMarkersReference smallRef(markerTable.getColumnLabels(), 2);
+    SimTK_ASSERT_ALWAYS(smallRef.putValues(0.0, frameValues(0)) &&
+                        smallRef.putValues(dt, frameValues(1)) &&
+                        !smallRef.putValues(2*dt, frameValues(2)),
+        "BufferedMarkersReference did not drop a frame when full.");
+    SimTK_ASSERT_ALWAYS(smallRef.getNumDroppedFrames() == 1 &&
+                        smallRef.getNumFramesInBuffer() == 2,
+        "BufferedMarkersReference miscounted its frames.");
+    double time;
+    SimTK::Array_<SimTK::Vec3> values;
+    SimTK_ASSERT_ALWAYS(smallRef.getNextValuesAndTime(time, values) &&
+                        time == 0.0 && values == frameValues(0),
+        "BufferedMarkersReference did not return the oldest frame.");
+
+    // With no latency budget, only the newest waiting frame is solved.
+    for (int i = 0; i < 10; ++i)
+        markersRef.putValues(markerTable.getIndependentColumn()[i],
+                             frameValues(i));
+    ikSolver.setLatencyBudget(0);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    SimTK_ASSERT_ALWAYS(ikSolver.solveNextFrame(state) &&
+                        state.getTime() == states[9].getTime() &&
+                        ikSolver.getNumFramesSkipped() == 9,
+        "Streaming IK did not skip frames that exceeded the latency budget.");
+    SimTK_ASSERT_ALWAYS(abs(coord.getValue(state) -
+                            coord.getValue(states[9])) < 1e-6,
+        "Streaming IK failed to track the newest frame.");
+}
 
 Model* constructPendulumWithMarkers()
 {
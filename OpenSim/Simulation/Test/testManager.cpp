@@ -36,6 +36,8 @@ Manager Tests:
    arm26 model between subsequent integrations.
 4. testConstructors: Ensure different constructors work as intended.
 5. testSimulate: Ensure the simulate() method works as intended.
+6. testEnsembleManager: Integrate many runs of a falling ball, with different
+   initial states and gravity, with one and with several threads.
 
 //=============================================================================*/
 #include <OpenSim/Simulation/Model/Model.h>
@@ -43,6 +45,7 @@ Manager Tests:
 #include <OpenSim/Simulation/SimbodyEngine/FreeJoint.h>
 #include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
+#include <OpenSim/Simulation/Manager/EnsembleManager.h>
 #include <OpenSim/Common/LoadOpenSimLibrary.h>
 #include <OpenSim/Simulation/Control/PrescribedController.h>
 #include <OpenSim/Common/Constant.h>
@@ -55,6 +58,7 @@ void testStateChangesBetweenIntegration();
 void testExcitationUpdatesWithManager();
 void testConstructors();
 void testSimulate();
+void testEnsembleManager();
 
 int main()
 {
@@ -90,6 +94,12 @@ int main()
         failures.push_back("testSimulate");
     }
 
+    try { testEnsembleManager(); }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        failures.push_back("testEnsembleManager");
+    }
+
     if (!failures.empty()) {
         cout << "Done, with failure(s): " << failures << endl;
         return 1;
@@ -420,3 +430,86 @@ void testSimulate()
         SimTK_TEST_EQ(s.getTime(), t0);
     }
 }
+
+void testEnsembleManager()
+{
+    cout << "Running testEnsembleManager" << endl;
+
+    using SimTK::Vec3;
+
+    // A ball that falls freely.
+    Model model;
+    model.setGravity(Vec3(0, -9.81, 0));
+    auto ball = new Body("ball", 1., Vec3(0), SimTK::Inertia::sphere(1.));
+    model.addBody(ball);
+    auto freeJoint = new FreeJoint("freeJoint", model.getGround(), *ball);
+    freeJoint->updCoordinate(FreeJoint::Coord::TranslationY).setName("ty");
+    model.addJoint(freeJoint);
+    SimTK::State& s = model.initSystem();
+    const Coordinate& ty = model.getCoordinateSet().get("ty");
+
+    // Runs 3k and 3k+2 differ in their initial speed; runs 3k+1 also use a
+    // different gravity, so the copies of the model must be restored to the
+    // original gravity between runs.
+    const int numRuns = 12;
+    const double finalTime = 1.0;
+    EnsembleManager ensemble(model);
+    std::vector<double> y0(numRuns), v0(numRuns), g(numRuns, 9.81);
+    for (int i = 0; i < numRuns; ++i) {
+        y0[i] = 0.1*i;
+        v0[i] = i % 3 == 1 ? 0 : 0.5*i;
+        ty.setValue(s, y0[i]);
+        ty.setSpeedValue(s, v0[i]);
+        if (i % 3 == 1) {
+            g[i] = 1.0 + i;
+            ensemble.addRun({{"/", "gravity",
+                              "0 " + std::to_string(-g[i]) + " 0"}}, s);
+        } else {
+            ensemble.addRun(s);
+        }
+    }
+    ASSERT(ensemble.getNumRuns() == numRuns);
+    ASSERT_THROW(OpenSim::Exception, ensemble.getStatesTable(0));
+    ensemble.setIntegratorAccuracy(1e-8);
+    ensemble.setReportingInterval(0.3);
+
+    std::vector<TimeSeriesTable> serial;
+    for (int numThreads : {1, 3, 0}) {
+        ensemble.setNumThreads(numThreads);
+        ensemble.integrate(finalTime);
+        for (int i = 0; i < numRuns; ++i) {
+            const TimeSeriesTable& table = ensemble.getStatesTable(i);
+            // 0, 0.3, 0.6, 0.9 and the final time.
+            ASSERT(table.getNumRows() == 5);
+            ASSERT_EQUAL(finalTime, table.getIndependentColumn().back(), 0.0);
+            const auto& y = table.getDependentColumn(
+                    "freeJoint/ty/value");
+            for (size_t k = 0; k < table.getNumRows(); ++k) {
+                const double t = table.getIndependentColumn()[k];
+                ASSERT_EQUAL(y0[i] + v0[i]*t - 0.5*g[i]*t*t, y[k], 1e-6);
+            }
+            if (numThreads == 1) {
+                serial.push_back(table);
+            } else {
+                SimTK_TEST_EQ(serial[i].getMatrix(), table.getMatrix());
+            }
+        }
+    }
+
+    // A recorded state can be realized by copying it into a State of the
+    // original model.
+    const TimeSeriesTable& table = ensemble.getStatesTable(2);
+    const auto row = table.getRowAtIndex(4);
+    SimTK::Vector values((int)table.getNumColumns());
+    for (int j = 0; j < values.size(); ++j) values[j] = row[j];
+    s.setTime(table.getIndependentColumn()[4]);
+    model.setStateVariableValues(s, values);
+    model.realizeVelocity(s);
+    ASSERT_EQUAL(y0[2] + v0[2]*finalTime - 0.5*g[2]*finalTime*finalTime,
+                 ty.getValue(s), 1e-6);
+
+    // Errors in a run are reported after all the runs are done.
+    ensemble.addRun({{"/forceset/nonexistent", "appliesForce", "false"}});
+    ASSERT_THROW(OpenSim::Exception, ensemble.integrate(finalTime));
+    ASSERT(ensemble.getStatesTable(0).getNumRows() == 5);
+}
@@ -26,12 +26,16 @@
 #include <OpenSim/Simulation/SimbodyEngine/PinJoint.h>
 #include <OpenSim/Simulation/Manager/Manager.h>
 #include <OpenSim/Common/LoadOpenSimLibrary.h>
+#include <OpenSim/Common/ObjectSnapshot.h>
+
+#include <fstream>
 
 using namespace OpenSim;
 using namespace std;
 
 void testModelFinalizePropertiesAndConnections();
 void testModelTopologyErrors();
+void testModelSnapshot();
 
 int main() {
     LoadOpenSimLibrary("osimActuators");
@@ -39,6 +43,7 @@ int main() {
     SimTK_START_TEST("testModelInterface");
         SimTK_SUBTEST(testModelFinalizePropertiesAndConnections);
         SimTK_SUBTEST(testModelTopologyErrors);
+        SimTK_SUBTEST(testModelSnapshot);
     SimTK_END_TEST();
 }
 
@@ -226,6 +231,55 @@ void testModelTopologyErrors()
     ASSERT_THROW(JointFramesHaveSameBaseFrame, degenerate.initSystem());
 }
 
-
-
+void testModelSnapshot()
+{
+    // Work on a copy of the model file, which is edited below. This model is
+    // in an old format and has splines in its knee joints, which a snapshot
+    // must reproduce without going through updateFromXMLNode().
+    {
+        std::ifstream in("gait2354_simbody.osim", std::ios::binary);
+        std::ofstream out("testModelSnapshot.osim", std::ios::binary);
+        out << in.rdbuf();
+    }
+    Model model("testModelSnapshot.osim");
+    model.printSnapshot("testModelSnapshot.osnap");
+
+    ASSERT(ObjectSnapshot::isSnapshotFile("testModelSnapshot.osnap"));
+    ASSERT(!ObjectSnapshot::isSnapshotFile("testModelSnapshot.osim"));
+    ASSERT(ObjectSnapshot::isUpToDate("testModelSnapshot.osnap"));
+
+    Model snapshot("testModelSnapshot.osnap");
+    ASSERT(snapshot == model);
+    ASSERT(snapshot.getInputFileName() == "testModelSnapshot.osnap");
+
+    SimTK::State& s = model.initSystem();
+    SimTK::State& sSnapshot = snapshot.initSystem();
+    ASSERT(sSnapshot.getNY() == s.getNY());
+    ASSERT((sSnapshot.getY() - s.getY()).normInf() == 0);
+
+    const Coordinate& knee = model.getCoordinateSet().get("knee_angle_r");
+    knee.setValue(s, -1.0);
+    snapshot.getCoordinateSet().get("knee_angle_r").setValue(sSnapshot, -1.0);
+    for (int i = 0; i < model.getMuscles().getSize(); ++i) {
+        ASSERT_EQUAL(model.getMuscles()[i].getLength(s),
+                     snapshot.getMuscles()[i].getLength(sSnapshot),
+                     SimTK::Eps);
+    }
+
+    // A snapshot is made from the source file, not from changes in memory.
+    model.setName("testModelSnapshot_renamed");
+    model.printSnapshot("testModelSnapshot3.osnap");
+    Model fromFile("testModelSnapshot3.osnap");
+    ASSERT(fromFile.getName() == snapshot.getName());
+
+    // A snapshot of a model loaded from a snapshot refers to the same source.
+    snapshot.printSnapshot("testModelSnapshot2.osnap");
+    ASSERT(ObjectSnapshot::getSourceFileName("testModelSnapshot2.osnap") ==
+           ObjectSnapshot::getSourceFileName("testModelSnapshot.osnap"));
+
+    // Once the source file changes, the snapshot is stale.
+    std::ofstream("testModelSnapshot.osim", std::ios::app) << "<!-- -->\n";
+    ASSERT(!ObjectSnapshot::isUpToDate("testModelSnapshot.osnap"));
+    ASSERT_THROW(OpenSim::Exception, Model stale("testModelSnapshot.osnap"));
+}
 
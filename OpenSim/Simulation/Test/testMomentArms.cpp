@@ -55,6 +55,8 @@ void testMomentArmDefinitionForModel(const string &filename,
                                      double mass = -1.0, string errorMessage = "");
 
 void testMomentArmsAcrossCompoundJoint();
+void testBatchedMomentArmSolve(const string &filename);
+void testMomentArmSparsity();
 
 int main()
 {
@@ -67,6 +69,15 @@ int main()
         testMomentArmsAcrossCompoundJoint();
         cout << "Joint composed of more than one mobilized body: PASSED\n" << endl;
 
+        testMomentArmSparsity();
+        cout << "Structurally zero moment-arms are detected from topology: PASSED\n" << endl;
+
+        testBatchedMomentArmSolve("gait2354_simbody.osim");
+        cout << "Batched moment-arms of gait2354 match individual solves: PASSED\n" << endl;
+
+        testBatchedMomentArmSolve("testMomentArmsConstraintB.osim");
+        cout << "Batched moment-arms with coupled coordinates match individual solves: PASSED\n" << endl;
+
         testMomentArmDefinitionForModel("BothLegs22.osim", "r_knee_angle", "VASINT", 
             SimTK::Vec2(-2*SimTK::Pi/3, SimTK::Pi/18), 0.0, 
             "VASINT of BothLegs with no mass: FAILED");
@@ -166,6 +177,88 @@ void testMomentArmsAcrossCompoundJoint()
         0.0, "testMomentArmsAcrossCompoundJoint: FAILED");
 }
 
+//==========================================================================================================
+// A path can only depend on the coordinates of the joints between the bodies
+// it spans (and on the coordinates that move its moving path points).
+//==========================================================================================================
+void testMomentArmSparsity()
+{
+    Model model("gait2354_simbody.osim");
+    SimTK::State& s = model.initSystem();
+
+    const CoordinateSet& coords = model.getCoordinateSet();
+    const GeometryPath& path =
+        model.getMuscles().get("vas_int_r").getGeometryPath();
+
+    // vas_int_r spans the femur and the tibia
+    ASSERT(path.canDependOnCoordinate(coords.get("knee_angle_r")),
+        __FILE__, __LINE__, "vas_int_r must depend on knee_angle_r.");
+
+    // Joints above the femur move the whole path rigidly and joints of the
+    // other leg are on a different branch of the tree.
+    for (const string& name : { "pelvis_tx", "pelvis_tilt", "hip_flexion_r",
+            "lumbar_extension", "knee_angle_l", "ankle_angle_r" }) {
+        ASSERT(!path.canDependOnCoordinate(coords.get(name)),
+            __FILE__, __LINE__, "vas_int_r must not depend on " + name + ".");
+        ASSERT(path.computeMomentArm(s, coords.get(name)) == 0.0,
+            __FILE__, __LINE__, "Moment-arm of vas_int_r about " + name +
+            " must be structurally zero.");
+    }
+
+    // A copy has not been added to a System and so makes no assumptions.
+    GeometryPath pathCopy(path);
+    ASSERT(pathCopy.canDependOnCoordinate(coords.get("knee_angle_l")),
+        __FILE__, __LINE__, "A copied path must not assume any sparsity.");
+}
+
+//==========================================================================================================
+// The batched solve of all muscles about all coordinates must reproduce the
+// moment-arms computed one (coordinate, path) pair at a time.
+//==========================================================================================================
+void testBatchedMomentArmSolve(const string &filename)
+{
+    Model model(filename);
+    SimTK::State& s = model.initSystem();
+
+    const CoordinateSet& coords = model.getCoordinateSet();
+    const Set<Muscle>& muscles = model.getMuscles();
+
+    // Perturb the pose away from the default so that moment-arms are generic
+    for (int j = 0; j < coords.getSize(); ++j) {
+        if (!coords[j].getLocked(s))
+            coords[j].setValue(s, coords[j].getValue(s) + 0.1*(j%3), false);
+    }
+    model.assemble(s);
+    model.realizeVelocity(s);
+
+    SimTK::Array_<const Coordinate*> coordList;
+    for (int j = 0; j < coords.getSize(); ++j)
+        coordList.push_back(&coords[j]);
+    SimTK::Array_<const GeometryPath*> pathList;
+    for (int i = 0; i < muscles.getSize(); ++i)
+        pathList.push_back(&muscles[i].getGeometryPath());
+
+    MomentArmSolver batchSolver(model);
+    SimTK::Matrix ma = batchSolver.solve(s, coordList, pathList);
+
+    ASSERT(ma.nrow() == muscles.getSize(), __FILE__, __LINE__,
+        "Batched moment-arm matrix has the wrong number of rows.");
+    ASSERT(ma.ncol() == coords.getSize(), __FILE__, __LINE__,
+        "Batched moment-arm matrix has the wrong number of columns.");
+
+    MomentArmSolver singleSolver(model);
+    for (int i = 0; i < muscles.getSize(); ++i) {
+        for (int j = 0; j < coords.getSize(); ++j) {
+            double expected = singleSolver.solve(s, coords[j],
+                muscles[i].getGeometryPath());
+            ASSERT_EQUAL(expected, double(ma(i, j)), 1e-8,
+                __FILE__, __LINE__, "Batched moment-arm of " +
+                muscles[i].getName() + " about " + coords[j].getName() +
+                " does not match the individual solve.");
+        }
+    }
+}
+
 //==========================================================================================================
 // moment_arm = dl/dtheta, definition using inexact perturbation technique
 //==========================================================================================================
@@ -143,6 +143,7 @@ void PathWrap::resetPreviousWrap()
 
     _previousWrap.wrap_pts.setSize(0);
     _previousWrap.wrap_path_length = 0.0;
+    _previousWrap.closest_point_param = SimTK::NaN;
 
     int i;
     for (i = 0; i < 3; i++) {
@@ -31,6 +31,7 @@
 #include <OpenSim/Common/Mtx.h>
 #include <OpenSim/Common/ModelDisplayHints.h>
 #include <OpenSim/Common/ScaleSet.h>
+#include <algorithm>
 
 //=============================================================================
 // STATICS
@@ -265,6 +266,7 @@ int WrapEllipsoid::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::
         aWrapResult.c1[i] = previousWrap.c1[i];
         aWrapResult.sv[i] = previousWrap.sv[i];
     }
+    aWrapResult.closest_point_param = previousWrap.closest_point_param;
 
     aFlag = true;
     aWrapResult.wrap_pts.setSize(0);
@@ -477,7 +479,7 @@ int WrapEllipsoid::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::
                 for (j = 0; j < 3; j++)
                     t_sv[0][j] = aWrapResult.r1[j] + tt * r1r2[j];
 
-                findClosestPoint(a[0], a[1], a[2], t_sv[0][0], t_sv[0][1], t_sv[0][2], &t_c1[0][0], &t_c1[0][1], &t_c1[0][2]);
+                findClosestPoint(a[0], a[1], a[2], t_sv[0][0], t_sv[0][1], t_sv[0][2], &t_c1[0][0], &t_c1[0][1], &t_c1[0][2], -1, &aWrapResult.closest_point_param);
 
                 MAKE_3DVECTOR21(t_c1[0], t_sv[0], v);
 
@@ -496,7 +498,7 @@ int WrapEllipsoid::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::
 
             if (mu[bestMu] <= MU_BLEND_MIN)
             {
-                findClosestPoint(a[0], a[1], a[2], t_c1[0][0], t_c1[0][1], t_c1[0][2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2]);
+                findClosestPoint(a[0], a[1], a[2], t_c1[0][0], t_c1[0][1], t_c1[0][2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2], -1, &aWrapResult.closest_point_param);
 
                 for (i = 0; i < 3; i++)
                     aWrapResult.sv[i] = t_sv[2][i];
@@ -509,7 +511,7 @@ int WrapEllipsoid::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::
 
                 double oneMinusT = 1.0 - tt;
 
-                findClosestPoint(a[0], a[1], a[2], t_c1[0][0], t_c1[0][1], t_c1[0][2], &t_c1[1][0], &t_c1[1][1], &t_c1[1][2]);
+                findClosestPoint(a[0], a[1], a[2], t_c1[0][0], t_c1[0][1], t_c1[0][2], &t_c1[1][0], &t_c1[1][1], &t_c1[1][2], -1, &aWrapResult.closest_point_param);
 
                 for (i = 0; i < 3; i++)
                 {
@@ -517,7 +519,7 @@ int WrapEllipsoid::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::
 
                     aWrapResult.sv[i] = tt * aWrapResult.sv[i] + oneMinusT * t_sv[2][i];
                 }
-                findClosestPoint(a[0], a[1], a[2], t_c1[2][0], t_c1[2][1], t_c1[2][2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2]);
+                findClosestPoint(a[0], a[1], a[2], t_c1[2][0], t_c1[2][1], t_c1[2][2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2], -1, &aWrapResult.closest_point_param);
 
                 fanWeight = oneMinusT;
             }
@@ -528,7 +530,7 @@ int WrapEllipsoid::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::
         for (i = 0; i < 3; i++)
             aWrapResult.sv[i] = aWrapResult.r1[i] + 0.5 * (aWrapResult.r2[i] - aWrapResult.r1[i]);
 
-        findClosestPoint(a[0], a[1], a[2], aWrapResult.sv[0], aWrapResult.sv[1], aWrapResult.sv[2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2]);
+        findClosestPoint(a[0], a[1], a[2], aWrapResult.sv[0], aWrapResult.sv[1], aWrapResult.sv[2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2], -1, &aWrapResult.closest_point_param);
     }
 
     // ==== COMPUTE WRAPPING PLANE (end) ====
@@ -582,7 +584,7 @@ int WrapEllipsoid::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::
 
                 tc1 = aWrapResult.c1;
 
-                findClosestPoint(a[0], a[1], a[2], tc1[0], tc1[1], tc1[2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2]);
+                findClosestPoint(a[0], a[1], a[2], tc1[0], tc1[1], tc1[2], &aWrapResult.c1[0], &aWrapResult.c1[1], &aWrapResult.c1[2], -1, &aWrapResult.closest_point_param);
             }
         }
     }
@@ -1044,12 +1046,15 @@ void WrapEllipsoid::CalcDistanceOnEllipsoid(SimTK::Vec3& r1, SimTK::Vec3& r2, Si
  * @param y Y coordinate of the closest point
  * @param z Z coordinate of the closest point
  * @param specialCaseAxis For dealing with uvw points near a major axis
+ * @param param If not null, the parameter of a previous solve (e.g., of a
+ * nearby point, or of the previous time step) from which to warm-start the
+ * iteration; set to the parameter of this solve on return
  * @return The distance between the ellipsoid and the point in space
  */
 double WrapEllipsoid::findClosestPoint(double a, double b, double c,
                                                     double u, double v, double w,
                                                     double* x, double* y, double* z,
-                                                    int specialCaseAxis) const
+                                                    int specialCaseAxis, double* param) const
 {
     // Graphics Gems IV algorithm for computing distance from point to
     // ellipsoid (x/a)^2 + (y/b)^2 +(z/c)^2 = 1.  The algorithm as stated
@@ -1109,27 +1114,41 @@ double WrapEllipsoid::findClosestPoint(double a, double b, double c,
         double u2 = u*u, v2 = v*v, w2 = w*w;
         double a2u2 = a2*u2, b2v2 = b2*v2, c2w2 = c2*w2;
         double dx, dy, dz, t, f;
+        double P{ 0 }, P2{ 0 }, Q{ 0 }, Q2{ 0 }, R{ 0 }, _R2{ 0 };
+        double PQ{ 0 }, PR{ 0 }, QR{ 0 }, PQR{ 0 }, fp{ 0 };
 
-        // initial guess
-        if ( (u/a)*(u/a) + (v/b)*(v/b) + (w/c)*(w/c) < 1.0 )
+        // initial guess. The iteration has to start to the right of the
+        // root, where f > 0, and converges monotonically from there. A
+        // previous parameter that is on that side is usually much closer to
+        // the root than the default guesses below.
+        bool warmStart = false;
+        if (param && !SimTK::isNaN(*param) && *param > -std::min(a2, std::min(b2, c2)))
         {
-            t = 0.0;
+            t = *param;
+            P = t+a2, P2 = P*P;
+            Q = t+b2, Q2 = Q*Q;
+            R = t+c2, _R2 = R*R;
+            warmStart = P2*Q2*_R2 - a2u2*Q2*_R2 - b2v2*P2*_R2 - c2w2*P2*Q2 > 0.0;
         }
-        else
+        if (!warmStart)
         {
-            double max = a;
-        
-            if ( b > max )
-                max = b;
-            if ( c > max )
-                max = c;
+            if ( (u/a)*(u/a) + (v/b)*(v/b) + (w/c)*(w/c) < 1.0 )
+            {
+                t = 0.0;
+            }
+            else
+            {
+                double max = a;
+            
+                if ( b > max )
+                    max = b;
+                if ( c > max )
+                    max = c;
 
-            t = max*sqrt(u*u+v*v+w*w);
+                t = max*sqrt(u*u+v*v+w*w);
+            }
         }
 
-        double P{ 0 }, P2{ 0 }, Q{ 0 }, Q2{ 0 }, R{ 0 }, _R2{ 0 };
-        double PQ{ 0 }, PR{ 0 }, QR{ 0 }, PQR{ 0 }, fp{ 0 };
-
         for (i = 0; i < 64; i++)
         {
             P = t+a2, P2 = P*P;
@@ -1147,6 +1166,9 @@ double WrapEllipsoid::findClosestPoint(double a, double b, double c,
                 dx = *x - u;
                 dy = *y - v;
                 dz = *z - w;
+
+                if (param)
+                    *param = t;
             
                 return sqrt(dx*dx+dy*dy+dz*dz);
             }
@@ -103,7 +103,7 @@ private:
     double findClosestPoint(double a, double b, double c,
         double u, double v, double w,
         double* x, double* y, double* z,
-        int specialCaseAxis = -1) const;
+        int specialCaseAxis = -1, double* param = nullptr) const;
     double closestPointToEllipse(double a, double b, double u,
         double v, double* x, double* y) const;
 //=============================================================================
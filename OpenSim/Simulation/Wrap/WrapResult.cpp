@@ -39,7 +39,8 @@ using namespace OpenSim;
 /**
  * Default constructor.
  */
-WrapResult::WrapResult()
+WrapResult::WrapResult() :
+    closest_point_param(SimTK::NaN)
 {
 }
 
@@ -53,14 +54,23 @@ WrapResult::~WrapResult()
 
 //_____________________________________________________________________________
 /**
- * Copy data members from one WrapResult to another.
+ * Copy data members from one WrapResult to another. The wrap points are
+ * copied into the storage this WrapResult already has, which is only grown
+ * if it is too small, so that copying between long-lived WrapResults does
+ * not allocate.
  *
  * @param aWrapResult WrapResult to be copied.
  */
 void WrapResult::copyData(const WrapResult& aWrapResult)
 {
-    wrap_pts = aWrapResult.wrap_pts;
+    if (&aWrapResult == this) return;
+
+    const int numWrapPoints = aWrapResult.wrap_pts.getSize();
+    wrap_pts.setSize(numWrapPoints);
+    for (int i = 0; i < numWrapPoints; i++)
+        wrap_pts[i] = aWrapResult.wrap_pts[i];
     wrap_path_length = aWrapResult.wrap_path_length;
+    closest_point_param = aWrapResult.closest_point_param;
 
     startPoint = aWrapResult.startPoint;
     endPoint = aWrapResult.endPoint;
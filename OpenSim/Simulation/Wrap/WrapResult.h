@@ -55,6 +55,8 @@ public:
     SimTK::Vec3 c1;              // intermediate point used by some wrap objects
     SimTK::Vec3 sv;              // intermediate point used by some wrap objects
     double factor;             // scale factor used to normalize parameters
+    double closest_point_param; // parameter of the last closest-point solve,
+                               // used to warm-start the next one
 
 //=============================================================================
 // METHODS
@@ -139,6 +139,27 @@ void WrapTorus::extendScale(const SimTK::State& s, const ScaleSet& scaleSet)
         (localScaleVector[0].norm() + localScaleVector[1].norm()) * 0.5;
    _innerRadius *= averageXYScale;
    _outerRadius *= averageXYScale;
+   _cylinder.set_radius(_innerRadius);
+   _cylinder.finalizeFromProperties();
+}
+
+//_____________________________________________________________________________
+/**
+ * Configure the cylinder that wrapLine() wraps over.
+ */
+void WrapTorus::extendFinalizeFromProperties()
+{
+    // Base class
+    Super::extendFinalizeFromProperties();
+
+    // The radii are checked by connectToModelAndBody().
+    if (_innerRadius < 0.0) return;
+
+    // Finalizing the cylinder sets up its quadrant (_wrapSign, _wrapAxis).
+    _cylinder.set_radius(_innerRadius);
+    _cylinder.set_length(CYL_LENGTH);
+    _cylinder.set_quadrant("+x");
+    _cylinder.finalizeFromProperties();
 }
 
 //_____________________________________________________________________________
@@ -181,6 +202,7 @@ void WrapTorus::copyData(const WrapTorus& aWrapTorus)
 {
     _innerRadius = aWrapTorus._innerRadius;
     _outerRadius = aWrapTorus._outerRadius;
+    _cylinder = aWrapTorus._cylinder;
 }
 
 //_____________________________________________________________________________
@@ -242,6 +264,7 @@ WrapTorus& WrapTorus::operator=(const WrapTorus& aWrapTorus)
 {
     // BASE CLASS
     WrapObject::operator=(aWrapTorus);
+    copyData(aWrapTorus);
 
     return(*this);
 }
@@ -273,13 +296,8 @@ int WrapTorus::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::Vec3
         return noWrap;
 
     // Now put a cylinder at closestPt and call the cylinder wrap code.
-    WrapCylinder cyl;//(rot, trans, quadrant, body, radius, length);
     SimTK::Vec3 cylXaxis, cylYaxis, cylZaxis; // cylinder axes in torus reference frame
 
-    cyl.set_radius(_innerRadius);
-    cyl.set_length(CYL_LENGTH);
-    cyl.set_quadrant("+x");
-
     closestPt *= -1;
 
     cylXaxis = closestPt;
@@ -299,7 +317,7 @@ int WrapTorus::wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::Vec3
     cylinderToTorus.setP(closestPtCyl);
     Vec3 p1 = cylinderToTorus.shiftFrameStationToBase(aPoint1);
     Vec3 p2 = cylinderToTorus.shiftFrameStationToBase(aPoint2);
-    int return_code = cyl.wrapLine(s, p1, p2, aPathWrap, aWrapResult, aFlag);
+    int return_code = _cylinder.wrapLine(s, p1, p2, aPathWrap, aWrapResult, aFlag);
    if (aFlag == true && return_code > 0) {
         aWrapResult.r1 = cylinderToTorus.shiftBaseStationToFrame(aWrapResult.r1);
         aWrapResult.r2 = cylinderToTorus.shiftBaseStationToFrame(aWrapResult.r2);
@@ -26,6 +26,7 @@
 
 // INCLUDE
 #include "WrapObject.h"
+#include "WrapCylinder.h"
 #include <OpenSim/Common/PropertyDbl.h>
 
 namespace OpenSim {
@@ -60,6 +61,12 @@ private:
     PropertyDbl _outerRadiusProp;
     double& _outerRadius;
 
+    // The cylinder that wrapLine() places at the point of the torus closest
+    // to the path segment; only its pose changes from one wrap to the next,
+    // and that is applied to the points rather than to the cylinder. It is
+    // configured by extendFinalizeFromProperties().
+    WrapCylinder _cylinder;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -86,6 +93,7 @@ public:
 
     void connectToModelAndBody(Model& aModel, PhysicalFrame& aBody) override;
 protected:
+    void extendFinalizeFromProperties() override;
     int wrapLine(const SimTK::State& s, SimTK::Vec3& aPoint1, SimTK::Vec3& aPoint2,
         const PathWrap& aPathWrap, WrapResult& aWrapResult, bool& aFlag) const override;
     /// Implement generateDecorations to draw geometry in visualizer
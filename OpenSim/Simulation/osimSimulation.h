@@ -71,6 +71,7 @@
 #include "Model/Ground.h"
 
 #include "Manager/Manager.h"
+#include "Manager/EnsembleManager.h"
 
 #include "Control/ControlSet.h"
 #include "Control/ControlSetController.h"
@@ -111,6 +112,7 @@
 #include "SimbodyEngine/SpatialTransform.h"
 
 #include "AssemblySolver.h"
+#include "BufferedMarkersReference.h"
 #include "CoordinateReference.h"
 #include "InverseDynamicsSolver.h"
 #include "InverseKinematicsSolver.h"
@@ -120,6 +122,7 @@
 #include "Solver.h"
 #include "StatesTrajectory.h"
 #include "StatesTrajectoryReporter.h"
+#include "StreamingInverseKinematicsSolver.h"
 
 #include "SimulationUtilities.h"
 
@@ -47,6 +47,8 @@ public:
 };
 
 void testWrapCylinder();
+void testWrapEllipsoidWarmStart();
+void testWrapTorus();
 void testWrapObjectUpdateFromXMLNode30515();
 void simulate(Model& osimModel, State& si, double initialTime, double finalTime);
 void simulateModelWithMusclesNoViz(const string &modelFile, double finalTime, double activation=0.5);
@@ -67,6 +69,20 @@ int main()
         std::cout << "Exception: " << e.what() << std::endl;
         failures.push_back("TestShoulderModel (multiple wrap)"); }
 
+    try{
+        testWrapEllipsoidWarmStart();
+    } catch (const std::exception& e) {
+         std::cout << "Exception: " << e.what() << std::endl;
+         failures.push_back("testWrapEllipsoidWarmStart");
+    }
+
+    try{
+        testWrapTorus();
+    } catch (const std::exception& e) {
+         std::cout << "Exception: " << e.what() << std::endl;
+         failures.push_back("testWrapTorus");
+    }
+
     try{
         testWrapObjectUpdateFromXMLNode30515();
     } catch (const std::exception& e) {
@@ -404,6 +420,75 @@ void testWrapCylinder()
     }
 }
 
+// Each closest-point solve on the ellipsoid is warm-started from the previous
+// one, so visiting the same poses in the opposite order starts every solve
+// from a different point; the lengths must not change.
+void testWrapEllipsoidWarmStart()
+{
+    Model model("test_wrapEllipsoid_vasint.osim");
+    SimTK::State& s = model.initSystem();
+    const Coordinate& knee = model.getCoordinateSet().get("knee_angle_r");
+    const GeometryPath& path =
+        model.getMuscles().get("vas_int_r").getGeometryPath();
+
+    const int nsteps = 20;
+    std::vector<double> lengths(nsteps + 1);
+    for (int i = 0; i <= nsteps; ++i) {
+        knee.setValue(s, -2.0*i/nsteps);
+        model.realizePosition(s);
+        lengths[i] = path.getLength(s);
+    }
+    for (int i = nsteps; i >= 0; --i) {
+        knee.setValue(s, -2.0*i/nsteps);
+        model.realizePosition(s);
+        ASSERT_EQUAL<double>(lengths[i], path.getLength(s), 1e-6);
+    }
+}
+
+// WrapTorus wraps over a cylinder that it configures when finalized. The
+// paths over the tori of the shoulder model must have the same lengths in a
+// copy of the model, and some of them must wrap.
+void testWrapTorus()
+{
+    Model model("TestShoulderWrapping.osim");
+    Model copy(model);
+    SimTK::State& s = model.initSystem();
+    SimTK::State& sCopy = copy.initSystem();
+
+    std::vector<std::string> torusPaths;
+    for (const auto& path : model.getComponentList<GeometryPath>()) {
+        const PathWrapSet& wraps = path.getWrapSet();
+        for (int i = 0; i < wraps.getSize(); ++i) {
+            if (dynamic_cast<const WrapTorus*>(wraps[i].getWrapObject())) {
+                torusPaths.push_back(path.getAbsolutePathString());
+                break;
+            }
+        }
+    }
+    ASSERT(!torusPaths.empty());
+
+    const Coordinate& elv = model.getCoordinateSet().get("shoulder_elv");
+    const Coordinate& elvCopy = copy.getCoordinateSet().get("shoulder_elv");
+    int numWrapped = 0;
+    const int nsteps = 10;
+    for (int i = 0; i <= nsteps; ++i) {
+        const double angle = -1.5 + 4.5*i/nsteps;
+        elv.setValue(s, angle);
+        elvCopy.setValue(sCopy, angle);
+        model.realizePosition(s);
+        copy.realizePosition(sCopy);
+        for (const auto& name : torusPaths) {
+            const auto& path = model.getComponent<GeometryPath>(name);
+            const auto& pathCopy = copy.getComponent<GeometryPath>(name);
+            ASSERT_EQUAL<double>(path.getLength(s), pathCopy.getLength(sCopy),
+                                 SimTK::Eps);
+            if (path.getCurrentPath(s).getSize() >
+                    path.getPathPointSet().getSize())
+                ++numWrapped;
+        }
+    }
+    ASSERT(numWrapped > 0);
+}
 
 void simulateModelWithMusclesNoViz(const string &modelFile, double finalTime, double activation)
 {
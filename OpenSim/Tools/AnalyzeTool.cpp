@@ -35,6 +35,11 @@
 #include <OpenSim/Simulation/Model/PrescribedForce.h>
 #include <OpenSim/Actuators/Thelen2003Muscle.h>
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 using namespace OpenSim;
 using namespace std;
 
@@ -59,6 +64,7 @@ AnalyzeTool::AnalyzeTool() :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _maxNumThreads(_maxNumThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(false)
 {
@@ -79,6 +85,7 @@ AnalyzeTool::AnalyzeTool(const string &aFileName, bool aLoadModelAndInput) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _maxNumThreads(_maxNumThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(aLoadModelAndInput)
 {
@@ -111,6 +118,7 @@ AnalyzeTool::AnalyzeTool(Model& aModel) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _maxNumThreads(_maxNumThreadsProp.getValueInt()),
     _printResultFiles(true),
     _loadModelAndInput(false)
 {
@@ -171,6 +179,7 @@ AnalyzeTool(const AnalyzeTool &aTool) :
     _coordinatesFileName(_coordinatesFileNameProp.getValueStr()),
     _speedsFileName(_speedsFileNameProp.getValueStr()),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
+    _maxNumThreads(_maxNumThreadsProp.getValueInt()),
     _loadModelAndInput(false)
 {
     setNull();
@@ -191,6 +200,7 @@ setNull()
     _coordinatesFileName = "";
     _speedsFileName = "";
     _lowpassCutoffFrequency = -1.0;
+    _maxNumThreads = 1;
 
     _statesStore = NULL;
 
@@ -236,6 +246,15 @@ void AnalyzeTool::setupProperties()
     _lowpassCutoffFrequencyProp.setName("lowpass_cutoff_frequency_for_coordinates");
     _propertySet.append( &_lowpassCutoffFrequencyProp );
 
+    comment = "Maximum number of threads used to analyze the frames. If greater than 1 (or 0, to use "
+                 "all available hardware threads), the frames are split into contiguous ranges that are "
+                 "analyzed concurrently on copies of the model, provided every analysis that is on is "
+                 "frame independent (e.g., MuscleAnalysis, BodyKinematics, PointKinematics, JointReaction). "
+                 "The default value is 1, so the frames are analyzed serially.";
+    _maxNumThreadsProp.setComment(comment);
+    _maxNumThreadsProp.setName("maximum_number_of_threads");
+    _propertySet.append( &_maxNumThreadsProp );
+
 }
 
 
@@ -259,6 +278,7 @@ operator=(const AnalyzeTool &aTool)
     _coordinatesFileName = aTool._coordinatesFileName;
     _speedsFileName = aTool._speedsFileName;
     _lowpassCutoffFrequency= aTool._lowpassCutoffFrequency;
+    _maxNumThreads = aTool._maxNumThreads;
     _statesStore = aTool._statesStore;
     _printResultFiles = aTool._printResultFiles;
     return(*this);
@@ -580,7 +600,7 @@ bool AnalyzeTool::run(bool plotting)
     //}
 
     cout<<"Executing the analyses from "<<ti<<" to "<<tf<<"..."<<endl;
-    run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates);
+    run(s, *_model, iInitial, iFinal, *_statesStore, _solveForEquilibriumForAuxiliaryStates, _maxNumThreads);
     _model->getMultibodySystem().realize(s, SimTK::Stage::Position );
     } catch (const Exception& x) {
         x.print(cout);
@@ -602,7 +622,17 @@ bool AnalyzeTool::run(bool plotting)
 //=============================================================================
 // HELPER
 //=============================================================================
-void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium)
+namespace {
+/**
+ * Analyze frames iFirst through iLast of aStatesStore with the analyses of
+ * aModel. The analyses begin at frame iFirst and end at frame iFinal (if it
+ * is among the frames analyzed); all other frames are steps. If
+ * aDiscardFirstFrame is true, what the analyses record when they begin is
+ * discarded, so that only frames after iFirst are in their storages.
+ */
+void analyzeFrames(SimTK::State& s, Model &aModel, int iFirst, int iLast,
+        int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium,
+        bool aDiscardFirstFrame)
 {
     AnalysisSet& analysisSet = aModel.updAnalysisSet();
 
@@ -652,7 +682,7 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
     // model defaults.
     SimTK::Vector stateValues = aModel.getStateVariableValues(s);
 
-    for(int i=iInitial;i<=iFinal;i++) {
+    for(int i=iFirst;i<=iLast;i++) {
         // tPrev = t;
         aStatesStore.getTime(i,s.updTime()); // time
         t = s.getTime();
@@ -687,8 +717,16 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
         // Make sure model is at least ready to provide kinematics
         aModel.getMultibodySystem().realize(s, SimTK::Stage::Velocity);
 
-        if(i==iInitial) {
+        if(i==iFirst) {
             analysisSet.begin(s);
+            if(aDiscardFirstFrame) {
+                for(int j=0;j<analysisSet.getSize();j++) {
+                    ArrayPtrs<Storage>& storages =
+                        analysisSet.get(j).getStorageList();
+                    for(int k=0;k<storages.getSize();k++)
+                        storages[k]->purge();
+                }
+            }
         } else if(i==iFinal) {
             analysisSet.end(s);
         // Step
@@ -697,3 +735,104 @@ void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal,
         }
     }
 }
+} // anonymous namespace
+
+void AnalyzeTool::run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium, int aMaxNumThreads)
+{
+    AnalysisSet& analysisSet = aModel.updAnalysisSet();
+
+    int numThreads = aMaxNumThreads;
+    if(numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+    // Every range of frames but the first also begins at the last frame of
+    // the preceding range, so each range needs at least two frames.
+    numThreads = std::min(numThreads, iFinal - iInitial);
+
+    if(numThreads > 1) {
+        for(int i=0;i<analysisSet.getSize();i++) {
+            const Analysis& analysis = analysisSet.get(i);
+            if(analysis.getOn() && !analysis.isFrameIndependent()) {
+                cout << "AnalyzeTool: analysis " << analysis.getName()
+                     << " (" << analysis.getConcreteClassName()
+                     << ") depends on earlier frames; analyzing the frames "
+                     << "serially." << endl;
+                numThreads = 1;
+                break;
+            }
+        }
+    }
+
+    if(numThreads <= 1) {
+        analyzeFrames(s, aModel, iInitial, iFinal, iFinal, aStatesStore,
+                aSolveForEquilibrium, false);
+        return;
+    }
+
+    // Split the frames into contiguous ranges; range k is
+    // [bounds[k], bounds[k+1]]. The first range is analyzed with aModel on
+    // this thread and each other range with a copy of aModel on a thread of
+    // its own. A range other than the first begins at the last frame of the
+    // preceding range and discards it, so that its analyses see every frame
+    // of the range as a step, just as they would if run serially.
+    std::vector<int> bounds(numThreads+1);
+    for(int k=0;k<=numThreads;k++)
+        bounds[k] = iInitial + (int)((long long)(iFinal-iInitial)*k/numThreads);
+
+    // Copying a model copies its analyses. The copies are made and their
+    // systems created here, before any frame is analyzed.
+    std::vector<std::unique_ptr<Model> > models;
+    std::vector<SimTK::State*> states;
+    const SimTK::Vector stateValues = aModel.getStateVariableValues(s);
+    for(int k=1;k<numThreads;k++) {
+        models.emplace_back(aModel.clone());
+        SimTK::State& sCopy = models.back()->initSystem();
+        models.back()->setStateVariableValues(sCopy, stateValues);
+        states.push_back(&sCopy);
+    }
+
+    std::vector<std::exception_ptr> errors(numThreads);
+    std::vector<std::thread> threads;
+    for(int k=1;k<numThreads;k++) {
+        threads.emplace_back([&, k] {
+            try {
+                analyzeFrames(*states[k-1], *models[k-1], bounds[k],
+                        bounds[k+1], iFinal, aStatesStore,
+                        aSolveForEquilibrium, true);
+            } catch(...) {
+                errors[k] = std::current_exception();
+            }
+        });
+    }
+    try {
+        analyzeFrames(s, aModel, bounds[0], bounds[1], iFinal, aStatesStore,
+                aSolveForEquilibrium, false);
+    } catch(...) {
+        errors[0] = std::current_exception();
+    }
+    for(auto& thread : threads)
+        thread.join();
+    for(const auto& error : errors)
+        if(error) std::rethrow_exception(error);
+
+    // Append the results of each copy, in order, to those of aModel.
+    for(int k=1;k<numThreads;k++) {
+        AnalysisSet& analysisSetCopy = models[k-1]->updAnalysisSet();
+        for(int i=0;i<analysisSet.getSize();i++) {
+            ArrayPtrs<Storage>& storages =
+                analysisSet.get(i).getStorageList();
+            ArrayPtrs<Storage>& storagesCopy =
+                analysisSetCopy.get(i).getStorageList();
+            if(storages.getSize() != storagesCopy.getSize()) {
+                string msg = "AnalyzeTool.run: ERROR- analysis " +
+                    analysisSet.get(i).getName() + " recorded a different "
+                    "number of storages on a copy of the model.";
+                throw Exception(msg,__FILE__,__LINE__);
+            }
+            for(int j=0;j<storages.getSize();j++) {
+                const Storage& storageCopy = *storagesCopy[j];
+                for(int r=0;r<storageCopy.getSize();r++)
+                    storages[j]->append(*storageCopy.getStateVector(r));
+            }
+        }
+    }
+}
@@ -68,6 +68,9 @@ private:
     /** Low-pass cut-off frequency for filtering the coordinates (does not apply to states). */
     PropertyDbl _lowpassCutoffFrequencyProp;
     double &_lowpassCutoffFrequency;
+    /** Maximum number of threads used to analyze the frames. */
+    PropertyInt _maxNumThreadsProp;
+    int &_maxNumThreads;
 
     /** Storage for the model states. */
     Storage *_statesStore;
@@ -119,6 +122,8 @@ public:
     void setSpeedsFileName(const std::string &aFileName) { _speedsFileName = aFileName; }
     double getLowpassCutoffFrequency() const { return _lowpassCutoffFrequency; }
     void setLowpassCutoffFrequency(double aLowpassCutoffFrequency) { _lowpassCutoffFrequency = aLowpassCutoffFrequency; }
+    int getMaximumNumberOfThreads() const { return _maxNumThreads; }
+    void setMaximumNumberOfThreads(int aMaxNumThreads) { _maxNumThreads = aMaxNumThreads; }
     const bool getLoadModelAndInput() const { return _loadModelAndInput; }
     void setLoadModelAndInput(bool b) { _loadModelAndInput = b; }
 
@@ -140,7 +145,19 @@ public:
     // HELPER
     //--------------------------------------------------------------------------
 #ifndef SWIG
-    static void run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium);
+    /**
+     * Analyze frames iInitial through iFinal of aStatesStore with the
+     * analyses of aModel.
+     *
+     * If aMaxNumThreads is greater than 1 (or 0, meaning as many threads as
+     * the hardware supports) and every analysis that is on is frame
+     * independent (see Analysis::isFrameIndependent()), the frames are split
+     * into contiguous ranges that are analyzed concurrently, each on its own
+     * copy of aModel. The results of each copy are then appended, in time
+     * order, to the storages of the analyses of aModel. Otherwise, the frames
+     * are analyzed one after another on aModel.
+     */
+    static void run(SimTK::State& s, Model &aModel, int iInitial, int iFinal, const Storage &aStatesStore, bool aSolveForEquilibrium, int aMaxNumThreads = 1);
 #endif
 //=============================================================================
 };  // END of class AnalyzeTool
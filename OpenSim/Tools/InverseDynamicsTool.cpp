@@ -33,6 +33,8 @@
 #include <OpenSim/Common/GCVSplineSet.h>
 #include <OpenSim/Common/Constant.h>
 
+#include <chrono>
+
 using namespace OpenSim;
 using namespace std;
 using namespace SimTK;
@@ -60,7 +62,8 @@ InverseDynamicsTool::InverseDynamicsTool() : DynamicsTool(),
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
     _outputGenForceFileName(_outputGenForceFileNameProp.getValueStr()),
     _jointsForReportingBodyForces(_jointsForReportingBodyForcesProp.getValueStrArray()),
-    _outputBodyForcesAtJointsFileName(_outputBodyForcesAtJointsFileNameProp.getValueStr())
+    _outputBodyForcesAtJointsFileName(_outputBodyForcesAtJointsFileNameProp.getValueStr()),
+    _numberOfThreads(_numberOfThreadsProp.getValueInt())
 {
     setNull();
 }
@@ -79,7 +82,8 @@ InverseDynamicsTool::InverseDynamicsTool(const string &aFileName, bool aLoadMode
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
     _outputGenForceFileName(_outputGenForceFileNameProp.getValueStr()),
     _jointsForReportingBodyForces(_jointsForReportingBodyForcesProp.getValueStrArray()),
-    _outputBodyForcesAtJointsFileName(_outputBodyForcesAtJointsFileNameProp.getValueStr())
+    _outputBodyForcesAtJointsFileName(_outputBodyForcesAtJointsFileNameProp.getValueStr()),
+    _numberOfThreads(_numberOfThreadsProp.getValueInt())
 {
     setNull();
     updateFromXMLDocument();
@@ -101,7 +105,8 @@ InverseDynamicsTool::InverseDynamicsTool(const InverseDynamicsTool &aTool) :
     _lowpassCutoffFrequency(_lowpassCutoffFrequencyProp.getValueDbl()),
     _outputGenForceFileName(_outputGenForceFileNameProp.getValueStr()),
     _jointsForReportingBodyForces(_jointsForReportingBodyForcesProp.getValueStrArray()),
-    _outputBodyForcesAtJointsFileName(_outputBodyForcesAtJointsFileNameProp.getValueStr())
+    _outputBodyForcesAtJointsFileName(_outputBodyForcesAtJointsFileNameProp.getValueStr()),
+    _numberOfThreads(_numberOfThreadsProp.getValueInt())
 {
     setNull();
     *this = aTool;
@@ -148,6 +153,12 @@ void InverseDynamicsTool::setupProperties()
     _outputBodyForcesAtJointsFileNameProp.setName("output_body_forces_file");
     _outputBodyForcesAtJointsFileNameProp.setValue("body_forces_at_joints.sto");
     _propertySet.append(&_outputBodyForcesAtJointsFileNameProp);
+
+    _numberOfThreadsProp.setComment("Number of threads among which the time frames are split. "
+        "The default value is 1; 0 uses as many threads as there are cores.");
+    _numberOfThreadsProp.setName("number_of_threads");
+    _numberOfThreadsProp.setValue(1);
+    _propertySet.append(&_numberOfThreadsProp);
 }
 
 //_____________________________________________________________________________
@@ -179,6 +190,7 @@ operator=(const InverseDynamicsTool &aTool)
     _lowpassCutoffFrequency = aTool._lowpassCutoffFrequency;
     _outputGenForceFileName = aTool._outputGenForceFileName;
     _outputBodyForcesAtJointsFileName = aTool._outputBodyForcesAtJointsFileName;
+    _numberOfThreads = aTool._numberOfThreads;
     _coordinateValues = NULL;
 
     return(*this);
@@ -318,8 +330,19 @@ bool InverseDynamicsTool::run()
 
         // create the solver given the input data
         InverseDynamicsSolver ivdSolver(*_model);
+        ivdSolver.setNumberOfThreads(_numberOfThreads);
+
+        JointSet jointsForEquivalentBodyForces;
+        getJointsByName(*_model, _jointsForReportingBodyForces, jointsForEquivalentBodyForces);
+        int nj = jointsForEquivalentBodyForces.getSize();
+        Array_<const Joint*> joints(nj);
+        for(int j=0; j<nj; ++j){
+            joints[j] = &jointsForEquivalentBodyForces[j];
+        }
 
-        const clock_t start = clock();
+        // Wall-clock time: clock() would add up the CPU time of all the
+        // threads that solve the trajectory.
+        const auto start = std::chrono::steady_clock::now();
 
         int nt = final_index-start_index+1;
         
@@ -330,18 +353,19 @@ bool InverseDynamicsTool::run()
 
         // Preallocate results
         Array_<Vector> genForceTraj(nt, Vector(nq, 0.0));
+        Array_<Vector_<SpatialVec> > bodyForceTraj(nt, Vector_<SpatialVec>(nj));
 
         // solve for the trajectory of generalized forces that correspond to the 
-        // coordinate trajectories provided
-        ivdSolver.solve(s, *coordFunctions, times, genForceTraj);
+        // coordinate trajectories provided, and the equivalent body forces at
+        // the requested joints
+        ivdSolver.solve(s, *coordFunctions, times, genForceTraj,
+                        joints, bodyForceTraj);
         success = true;
 
+        const std::chrono::duration<double> duration =
+            std::chrono::steady_clock::now() - start;
         cout << "InverseDynamicsTool: " << nt << " time frames in " 
-            << (double)(clock()-start)/CLOCKS_PER_SEC << "s\n" <<endl;
-    
-        JointSet jointsForEquivalentBodyForces;
-        getJointsByName(*_model, _jointsForReportingBodyForces, jointsForEquivalentBodyForces);
-        int nj = jointsForEquivalentBodyForces.getSize();
+            << duration.count() << "s\n" <<endl;
 
         // Generalized forces from ID Solver are in MultibodyTree order and not
         // necessarily in the order of the Coordinates in the Model.
@@ -366,31 +390,21 @@ bool InverseDynamicsTool::run()
 
         Storage genForceResults(nt);
         Storage bodyForcesResults(nt);
-        SpatialVec equivalentBodyForceAtJoint;
 
         for(int i=0; i<nt; i++){
             StateVector
                 genForceVec(times[i], genForceTraj[i]);
             genForceResults.append(genForceVec);
 
-            // if there are joints requested for equivalent body forces then calculate them
+            // if there are joints requested for equivalent body forces then report them
             if(nj>0){
                 Vector forces(6*nj, 0.0);
                 StateVector bodyForcesVec(times[i],
                                           SimTK::Vector_<double>(6*nj,
                                                                  &forces[0]));
 
-                s.updTime() = times[i];
-                Vector &q = s.updQ();
-                Vector &u = s.updU();
-
-                for(int j=0; j<nq; ++j){
-                    q[j] = coordFunctions->evaluate(j, 0, times[i]);
-                    u[j] = coordFunctions->evaluate(j, 1, times[i]);
-                }
-            
                 for(int j=0; j<nj; ++j){
-                    equivalentBodyForceAtJoint = jointsForEquivalentBodyForces[j].calcEquivalentSpatialForce(s, genForceTraj[i]);
+                    const SpatialVec& equivalentBodyForceAtJoint = bodyForceTraj[i][j];
                     for(int k=0; k<3; ++k){
                         // body force components
                         bodyForcesVec.setDataValue(6*j+k, equivalentBodyForceAtJoint[1][k]); 
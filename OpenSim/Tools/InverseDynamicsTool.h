@@ -88,6 +88,11 @@ protected:
     PropertyStr _outputBodyForcesAtJointsFileNameProp;
     std::string &_outputBodyForcesAtJointsFileName;
 
+    /** Number of threads among which the time frames are split (0 for as
+        many as there are cores) */
+    PropertyInt _numberOfThreadsProp;
+    int &_numberOfThreads;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -156,6 +161,14 @@ public:
     void setLowpassCutoffFrequency(double aFrequency) {
         _lowpassCutoffFrequency = aFrequency;
     }
+    /**
+     * get/set the number of threads used to solve the time frames; 0 uses as
+     * many threads as there are cores
+     */
+    int getNumberOfThreads() const { return _numberOfThreads; }
+    void setNumberOfThreads(int aNumberOfThreads) {
+        _numberOfThreads = aNumberOfThreads;
+    }
     //--------------------------------------------------------------------------
     // INTERFACE
     //--------------------------------------------------------------------------
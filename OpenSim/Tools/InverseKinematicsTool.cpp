@@ -36,6 +36,11 @@
 
 #include <OpenSim/Analyses/Kinematics.h>
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 #include "IKTaskSet.h"
 #include "IKCoordinateTask.h"
 #include "IKMarkerTask.h"
@@ -70,7 +75,8 @@ InverseKinematicsTool::InverseKinematicsTool() : Tool(),
     _timeRange(_timeRangeProp.getValueDblArray()),
     _reportErrors(_reportErrorsProp.getValueBool()),
     _outputMotionFileName(_outputMotionFileNameProp.getValueStr()),
-    _reportMarkerLocations(_reportMarkerLocationsProp.getValueBool())
+    _reportMarkerLocations(_reportMarkerLocationsProp.getValueBool()),
+    _maxNumThreads(_maxNumThreadsProp.getValueInt())
 {
     setNull();
 }
@@ -95,7 +101,8 @@ InverseKinematicsTool::InverseKinematicsTool(const string &aFileName, bool aLoad
     _timeRange(_timeRangeProp.getValueDblArray()),
     _reportErrors(_reportErrorsProp.getValueBool()),
     _outputMotionFileName(_outputMotionFileNameProp.getValueStr()),
-    _reportMarkerLocations(_reportMarkerLocationsProp.getValueBool())
+    _reportMarkerLocations(_reportMarkerLocationsProp.getValueBool()),
+    _maxNumThreads(_maxNumThreadsProp.getValueInt())
 {
     setNull();
     updateFromXMLDocument();
@@ -123,7 +130,8 @@ InverseKinematicsTool::InverseKinematicsTool(const InverseKinematicsTool &aTool)
     _timeRange(_timeRangeProp.getValueDblArray()),
     _reportErrors(_reportErrorsProp.getValueBool()),
     _outputMotionFileName(_outputMotionFileNameProp.getValueStr()),
-    _reportMarkerLocations(_reportMarkerLocationsProp.getValueBool())
+    _reportMarkerLocations(_reportMarkerLocationsProp.getValueBool()),
+    _maxNumThreads(_maxNumThreadsProp.getValueInt())
 {
     setNull();
     *this = aTool;
@@ -216,6 +224,17 @@ void InverseKinematicsTool::setupProperties()
     _reportMarkerLocationsProp.setName("report_marker_locations");
     _reportMarkerLocationsProp.setValue(false);
     _propertySet.append(&_reportMarkerLocationsProp);
+
+    _maxNumThreadsProp.setComment(
+        "Maximum number of threads used to solve the frames. If greater than 1 "
+        "(or 0, to use all available hardware threads), the time range is split "
+        "into contiguous chunks that are solved concurrently, each on its own "
+        "copy of the model and starting from a full assembly at its first "
+        "frame. Results match those of a serial solution to within the "
+        "accuracy of the solver. The default is 1 (serial).");
+    _maxNumThreadsProp.setName("maximum_number_of_threads");
+    _maxNumThreadsProp.setValue(1);
+    _propertySet.append(&_maxNumThreadsProp);
 }
 
 //_____________________________________________________________________________
@@ -252,6 +271,7 @@ operator=(const InverseKinematicsTool &aTool)
     _reportErrors = aTool._reportErrors;
     _outputMotionFileName = aTool._outputMotionFileName;
     _reportMarkerLocations = aTool._reportMarkerLocations;
+    _maxNumThreads = aTool._maxNumThreads;
 
     return(*this);
 }
@@ -359,9 +379,111 @@ bool InverseKinematicsTool::run()
 
         const clock_t start = clock();
 
+        int numThreads = _maxNumThreads > 0 ? _maxNumThreads :
+            std::max(1, int(std::thread::hardware_concurrency()));
+        numThreads = std::min(numThreads, Nframes);
+
+        // When solving in parallel, the solution (and what is reported) for
+        // every frame is computed up front, in chunks of consecutive frames.
+        // The frames are then processed in order below just as when solving
+        // serially, so that reporters and analyses see the same sequence.
+        struct IKFrame {
+            SimTK::Vector q;
+            SimTK::Array_<double> squaredMarkerErrors;
+            SimTK::Array_<Vec3> markerLocations;
+        };
+        std::vector<IKFrame> frames;
+        if (numThreads > 1) {
+            frames.resize(Nframes);
+
+            auto solveFrames = [&](InverseKinematicsSolver& solver,
+                                   SimTK::State& state, int first, int last) {
+                for (int i = first; i <= last; ++i) {
+                    state.updTime() = times[i];
+                    solver.track(state);
+                    IKFrame& frame = frames[i - start_ix];
+                    frame.q = state.getQ();
+                    if (_reportErrors)
+                        solver.computeCurrentSquaredMarkerErrors(
+                            frame.squaredMarkerErrors);
+                    if (_reportMarkerLocations)
+                        solver.computeCurrentMarkerLocations(
+                            frame.markerLocations);
+                }
+            };
+
+            // Chunk k spans frames [bounds[k], bounds[k+1]-1]. The first chunk
+            // continues from the assembly above; every other chunk gets its
+            // own copy of the model (without analyses), references and solver,
+            // all created here before any thread starts, and begins with a
+            // full assembly at its first frame.
+            std::vector<int> bounds(numThreads + 1);
+            for (int k = 0; k <= numThreads; ++k)
+                bounds[k] = start_ix + int((long long)Nframes * k / numThreads);
+
+            std::vector<std::unique_ptr<Model>> models;
+            std::vector<std::unique_ptr<MarkersReference>> markersRefs;
+            std::vector<std::unique_ptr<SimTK::Array_<CoordinateReference>>>
+                coordinateRefs;
+            std::vector<std::unique_ptr<InverseKinematicsSolver>> solvers;
+            std::vector<SimTK::State*> states;
+            for (int k = 1; k < numThreads; ++k) {
+                models.emplace_back(_model->clone());
+                models.back()->updAnalysisSet().setMemoryOwner(true);
+                models.back()->updAnalysisSet().clearAndDestroy();
+                SimTK::State& state = models.back()->initSystem();
+                markersRefs.emplace_back(
+                    new MarkersReference(markersReference));
+                coordinateRefs.emplace_back(
+                    new SimTK::Array_<CoordinateReference>(
+                        coordinateReferences));
+                solvers.emplace_back(new InverseKinematicsSolver(
+                    *models.back(), *markersRefs.back(),
+                    *coordinateRefs.back(), _constraintWeight));
+                solvers.back()->setAccuracy(_accuracy);
+                state.updTime() = times[bounds[k]];
+                solvers.back()->assemble(state);
+                states.push_back(&state);
+            }
+
+            std::vector<std::exception_ptr> errors(numThreads);
+            std::vector<std::thread> threads;
+            for (int k = 1; k < numThreads; ++k) {
+                threads.emplace_back([&, k] {
+                    try {
+                        solveFrames(*solvers[k-1], *states[k-1],
+                                    bounds[k], bounds[k+1] - 1);
+                    } catch (...) {
+                        errors[k] = std::current_exception();
+                    }
+                });
+            }
+            try {
+                solveFrames(ikSolver, s, bounds[0], bounds[1] - 1);
+            } catch (...) {
+                errors[0] = std::current_exception();
+            }
+            for (auto& thread : threads)
+                thread.join();
+            for (const auto& error : errors)
+                if (error) std::rethrow_exception(error);
+        }
+
         for (int i = start_ix; i <= final_ix; ++i) {
             s.updTime() = times[i];
-            ikSolver.track(s);
+            if (frames.empty()) {
+                ikSolver.track(s);
+                if (_reportErrors)
+                    ikSolver.computeCurrentSquaredMarkerErrors(
+                        squaredMarkerErrors);
+                if (_reportMarkerLocations)
+                    ikSolver.computeCurrentMarkerLocations(markerLocations);
+            } else {
+                const IKFrame& frame = frames[i - start_ix];
+                s.updQ() = frame.q;
+                squaredMarkerErrors = frame.squaredMarkerErrors;
+                markerLocations = frame.markerLocations;
+            }
             
             if(_reportErrors){
                 Array<double> markerErrors(0.0, 3);
@@ -369,7 +491,6 @@ bool InverseKinematicsTool::run()
                 double maxSquaredMarkerError = 0.0;
                 int worst = -1;
 
-                ikSolver.computeCurrentSquaredMarkerErrors(squaredMarkerErrors);
                 for(int j=0; j<nm; ++j){
                     totalSquaredMarkerError += squaredMarkerErrors[j];
                     if(squaredMarkerErrors[j] > maxSquaredMarkerError){
@@ -392,7 +513,6 @@ bool InverseKinematicsTool::run()
             }
 
             if(_reportMarkerLocations){
-                ikSolver.computeCurrentMarkerLocations(markerLocations);
                 Array<double> locations(0.0, 3*nm);
                 for(int j=0; j<nm; ++j){
                     for(int k=0; k<3; ++k)
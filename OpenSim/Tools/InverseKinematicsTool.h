@@ -26,6 +26,7 @@
 #include "osimToolsDLL.h"
 #include <OpenSim/Common/PropertyDbl.h>
 #include <OpenSim/Common/PropertyDblArray.h>
+#include <OpenSim/Common/PropertyInt.h>
 #include "Tool.h"
 
 #ifdef SWIG
@@ -107,6 +108,10 @@ private:
     PropertyBool _reportMarkerLocationsProp;
     bool &_reportMarkerLocations;
 
+    // maximum number of threads used to solve the frames
+    PropertyInt _maxNumThreadsProp;
+    int &_maxNumThreads;
+
 //=============================================================================
 // METHODS
 //=============================================================================
@@ -137,6 +142,9 @@ public:
 
     void setCoordinateFileName(const std::string& coordDataFileName) { _coordinateFileName=coordDataFileName;};
     const std::string& getCoordinateFileName() const { return  _coordinateFileName;};
+
+    void setMaximumNumberOfThreads(int maxNumThreads) { _maxNumThreads = maxNumThreads; };
+    int getMaximumNumberOfThreads() const { return _maxNumThreads; };
     
     //const OpenSim::Storage& getOutputStorage() const;
 private:
@@ -0,0 +1,134 @@
+/* -------------------------------------------------------------------------- *
+ *                       OpenSim:  testAnalyzeTool.cpp                        *
+ * -------------------------------------------------------------------------- *
+ * The OpenSim API is a toolkit for musculoskeletal modeling and simulation.  *
+ * See http://opensim.stanford.edu and the NOTICE file for more information.  *
+ * OpenSim is developed at Stanford University and supported by the US        *
+ * National Institutes of Health (U54 GM072970, R24 HD065690) and by DARPA    *
+ * through the Warrior Web program.                                           *
+ *                                                                            *
+ * Copyright (c) 2005-2017 Stanford University and the Authors                *
+ *                                                                            *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may    *
+ * not use this file except in compliance with the License. You may obtain a  *
+ * copy of the License at http://www.apache.org/licenses/LICENSE-2.0.         *
+ *                                                                            *
+ * Unless required by applicable law or agreed to in writing, software        *
+ * distributed under the License is distributed on an "AS IS" BASIS,          *
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   *
+ * See the License for the specific language governing permissions and        *
+ * limitations under the License.                                             *
+ * -------------------------------------------------------------------------- */
+
+#include <OpenSim/Tools/AnalyzeTool.h>
+#include <OpenSim/Analyses/MuscleAnalysis.h>
+#include <OpenSim/Analyses/BodyKinematics.h>
+#include <OpenSim/Analyses/Kinematics.h>
+#include <OpenSim/Auxiliary/auxiliaryTestFunctions.h>
+
+#include <memory>
+
+using namespace OpenSim;
+using namespace std;
+
+// Analyze the same states serially and with several threads and verify that
+// the analyses record exactly the same results.
+void testParallelAnalyzeTool();
+
+int main()
+{
+    try {
+        testParallelAnalyzeTool();
+    }
+    catch (const std::exception& e) {
+        cout << e.what() << endl;
+        return 1;
+    }
+    cout << "Done" << endl;
+    return 0;
+}
+
+void testParallelAnalyzeTool()
+{
+    cout << "Test AnalyzeTool::run() with multiple threads." << endl;
+
+    Model model("gait2354_simbody.osim");
+    SimTK::State& s = model.initSystem();
+
+    // Swing the right leg through a range of motion.
+    Storage states;
+    Array<string> labels;
+    labels.append("time");
+    labels.append(model.getStateVariableNames());
+    states.setColumnLabels(labels);
+    const Coordinate& hip = model.getCoordinateSet().get("hip_flexion_r");
+    const Coordinate& knee = model.getCoordinateSet().get("knee_angle_r");
+    const int nFrames = 41;
+    for (int i = 0; i < nFrames; ++i) {
+        const double t = 0.025*i;
+        hip.setValue(s, 0.6*sin(SimTK::Pi*t), false);
+        knee.setValue(s, -0.8*sin(SimTK::Pi*t), false);
+        states.append(t, model.getStateVariableValues(s));
+    }
+
+    Array<string> coordinates;
+    coordinates.append("hip_flexion_r");
+    coordinates.append("knee_angle_r");
+
+    // Returns a copy of the model with a MuscleAnalysis and a BodyKinematics
+    // analysis that have analyzed all the states.
+    auto analyze = [&](int numThreads) {
+        std::unique_ptr<Model> copy{ model.clone() };
+        MuscleAnalysis* muscleAnalysis = new MuscleAnalysis();
+        muscleAnalysis->setCoordinates(coordinates);
+        muscleAnalysis->setComputeMoments(true);
+        copy->addAnalysis(muscleAnalysis);
+        copy->addAnalysis(new BodyKinematics());
+        copy->updAnalysisSet().setMemoryOwner(true);
+
+        SimTK::State& sCopy = copy->initSystem();
+        AnalyzeTool::run(sCopy, *copy, 0, nFrames - 1, states, false,
+                numThreads);
+        return copy;
+    };
+
+    std::unique_ptr<Model> serial = analyze(1);
+    for (int numThreads : { 2, 3, 4, 0 }) {
+        std::unique_ptr<Model> parallel = analyze(numThreads);
+        AnalysisSet& serialAnalyses = serial->updAnalysisSet();
+        AnalysisSet& parallelAnalyses = parallel->updAnalysisSet();
+        ASSERT_EQUAL(serialAnalyses.getSize(), parallelAnalyses.getSize(), 0);
+        for (int i = 0; i < serialAnalyses.getSize(); ++i) {
+            ArrayPtrs<Storage>& expected =
+                serialAnalyses.get(i).getStorageList();
+            ArrayPtrs<Storage>& received =
+                parallelAnalyses.get(i).getStorageList();
+            ASSERT(expected.getSize() > 0);
+            ASSERT_EQUAL(expected.getSize(), received.getSize(), 0);
+            for (int j = 0; j < expected.getSize(); ++j) {
+                ASSERT_EQUAL(expected[j]->getSize(), received[j]->getSize(),
+                        0);
+                for (int r = 0; r < expected[j]->getSize(); ++r) {
+                    const StateVector& e = *expected[j]->getStateVector(r);
+                    const StateVector& v = *received[j]->getStateVector(r);
+                    ASSERT_EQUAL(e.getTime(), v.getTime(), 0.0);
+                    ASSERT_EQUAL(e.getSize(), v.getSize(), 0);
+                    for (int k = 0; k < e.getSize(); ++k)
+                        ASSERT_EQUAL(e.getData()[k], v.getData()[k], 1e-10);
+                }
+            }
+        }
+    }
+
+    // An analysis that is not frame independent makes the tool analyze the
+    // frames serially.
+    {
+        std::unique_ptr<Model> copy{ model.clone() };
+        copy->addAnalysis(new Kinematics());
+        copy->updAnalysisSet().setMemoryOwner(true);
+        SimTK::State& sCopy = copy->initSystem();
+        AnalyzeTool::run(sCopy, *copy, 0, nFrames - 1, states, false, 4);
+        ASSERT_EQUAL(nFrames,
+            copy->updAnalysisSet().get(0).getStorageList()[0]->getSize(), 0);
+    }
+}
@@ -43,6 +43,8 @@ using namespace std;
  */
 VectorFunctionForActuators::~VectorFunctionForActuators()
 {
+    delete _timeStepper;
+    delete _integrator;
 }
 //_____________________________________________________________________________
 /**
@@ -63,6 +65,7 @@ VectorFunctionForActuators(SimTK::System *aActuatorSystem, Model* model, CMCActu
 
     // Don't project constraints while inside the controller
     _integrator->setProjectInterpolatedStates( false );
+    _timeStepper = new SimTK::TimeStepper(*aActuatorSystem, *_integrator);
     _f.setSize(getNX());
 }
 //_____________________________________________________________________________
@@ -99,6 +102,7 @@ setNull()
     _CMCActuatorSubsystem = NULL;
     _model             = NULL;
     _integrator        = NULL;
+    _timeStepper       = NULL;
 }
 
 //_____________________________________________________________________________
@@ -255,16 +259,17 @@ evaluate( const SimTK::State& s, double *aX, double *rF)
     CMC& controller=  dynamic_cast<CMC&>(_model->updControllerSet().get("CMC" ));
     controller.updControlSet().setControlValues(_tf, aX);
 
-    // create a Manager that will integrate just the actuator subsystem and use only the 
-    // CMC controller
+    // integrate just the actuator subsystem and use only the CMC controller.
+    // Only the actuator states and the time of the default state change from
+    // one evaluation to the next, so the same stepper is initialized again
+    // from it.
     SimTK::State& actSysState = _CMCActuatorSystem->updDefaultState();
     getCMCActSubsys()->updZ(actSysState) = _model->getMultibodySystem()
                                             .getDefaultSubsystem().getZ(s);
     actSysState.setTime(_ti);
 
-    SimTK::TimeStepper ts(*_CMCActuatorSystem, *_integrator);
-    ts.initialize(actSysState);
-    ts.stepTo(_tf);
+    _timeStepper->initialize(actSysState);
+    _timeStepper->stepTo(_tf);
 
     const Set<const Actuator>& forceSet = controller.getActuatorSet();
     // Vector function values
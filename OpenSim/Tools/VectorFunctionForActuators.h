@@ -33,6 +33,7 @@
 namespace SimTK {
 class Integrator;
 class System;
+class TimeStepper;
 }
 
 //=============================================================================
@@ -77,6 +78,9 @@ protected:
     CMCActuatorSubsystem* _CMCActuatorSubsystem;
     /** Integrator. */
     SimTK::Integrator* _integrator;
+    /** Stepper that drives the integrator; kept from one evaluation to the
+    next rather than created for each one. */
+    SimTK::TimeStepper* _timeStepper;
     /** Model */
     Model* _model;
 